@@ -13,8 +13,9 @@
 //===----------------------------------------------------------------------===//
 import Benchmark
 import Crypto
+import Dispatch
 import Foundation
-import _CryptoExtras
+@_spi(Benchmarks) import _CryptoExtras
 
 let benchmarks = {
     let defaultMetrics: [BenchmarkMetric] = [.mallocCountTotal, .cpuTotal]
@@ -99,4 +100,872 @@ let benchmarks = {
             blackHole(try privateKey.evaluate(blindedElement))
         }
     }
+
+    // Each iteration evaluates a whole batch, so compare per-iteration time against batch size times the unbatched cost.
+    for batchSize in [1, 8, 32, 128] {
+        Benchmark(
+            "voprf-evaluate-batch-p384-\(batchSize)",
+            configuration: Benchmark.Configuration(
+                metrics: defaultMetrics,
+                scalingFactor: .kilo,
+                maxDuration: .seconds(10_000_000),
+                maxIterations: 3
+            )
+        ) { benchmark in
+            let privateKey = P384._VOPRF.PrivateKey()
+            let publicKey = privateKey.publicKey
+            let blindedElements = try (0..<batchSize).map {
+                try publicKey.blind(Data("This is some input data \($0)".utf8)).blindedElement
+            }
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try privateKey.evaluate(batch: blindedElements))
+            }
+        }
+    }
+
+    // Each iteration evaluates once per thread, so per-iteration time stays flat as long as evaluation scales.
+    for threadCount in [1, 2, 4, 8] {
+        Benchmark(
+            "voprf-evaluate-p384-parallel-\(threadCount)",
+            configuration: Benchmark.Configuration(
+                metrics: defaultMetrics + [.wallClock],
+                scalingFactor: .kilo,
+                maxDuration: .seconds(10_000_000),
+                maxIterations: 3
+            )
+        ) { benchmark in
+            let privateKey = P384._VOPRF.PrivateKey()
+            let publicKey = privateKey.publicKey
+            let privateInput = Data("This is some input data".utf8)
+            let blindedInput = try publicKey.blind(privateInput)
+            let blindedElement = blindedInput.blindedElement
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                DispatchQueue.concurrentPerform(iterations: threadCount) { _ in
+                    blackHole(try! privateKey.evaluate(blindedElement))
+                }
+            }
+        }
+    }
+
+    // Signing and verifying should only allocate the signature itself.
+    let ecdsaConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics,
+        scalingFactor: .kilo,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 3
+    )
+
+    Benchmark("ecdsa-sign-p256", configuration: ecdsaConfiguration) { benchmark in
+        let privateKey = P256.Signing.PrivateKey()
+        let digest = SHA256.hash(data: Data("This is some input data".utf8))
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try privateKey.signature(for: digest))
+        }
+    }
+
+    Benchmark("ecdsa-verify-p256", configuration: ecdsaConfiguration) { benchmark in
+        let privateKey = P256.Signing.PrivateKey()
+        let publicKey = privateKey.publicKey
+        let digest = SHA256.hash(data: Data("This is some input data".utf8))
+        let signature = try privateKey.signature(for: digest)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.isValidSignature(signature, for: digest))
+        }
+    }
+
+    Benchmark("ecdsa-sign-p384", configuration: ecdsaConfiguration) { benchmark in
+        let privateKey = P384.Signing.PrivateKey()
+        let digest = SHA384.hash(data: Data("This is some input data".utf8))
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try privateKey.signature(for: digest))
+        }
+    }
+
+    Benchmark("ecdsa-verify-p384", configuration: ecdsaConfiguration) { benchmark in
+        let privateKey = P384.Signing.PrivateKey()
+        let publicKey = privateKey.publicKey
+        let digest = SHA384.hash(data: Data("This is some input data".utf8))
+        let signature = try privateKey.signature(for: digest)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.isValidSignature(signature, for: digest))
+        }
+    }
+
+    Benchmark("ecdsa-sign-p521", configuration: ecdsaConfiguration) { benchmark in
+        let privateKey = P521.Signing.PrivateKey()
+        let digest = SHA512.hash(data: Data("This is some input data".utf8))
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try privateKey.signature(for: digest))
+        }
+    }
+
+    Benchmark("ecdsa-verify-p521", configuration: ecdsaConfiguration) { benchmark in
+        let privateKey = P521.Signing.PrivateKey()
+        let publicKey = privateKey.publicKey
+        let digest = SHA512.hash(data: Data("This is some input data".utf8))
+        let signature = try privateKey.signature(for: digest)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.isValidSignature(signature, for: digest))
+        }
+    }
+
+    let aeadConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .kilo,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 10
+    )
+
+    for messageSize in [64, 1024, 16384] {
+        Benchmark("aes-gcm-seal-per-call-\(messageSize)", configuration: aeadConfiguration) { benchmark in
+            let key = SymmetricKey(size: .bits256)
+            let nonce = AES.GCM.Nonce()
+            let message = Data(repeating: 0x2A, count: messageSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try AES.GCM.seal(message, using: key, nonce: nonce))
+            }
+        }
+
+        Benchmark("aes-gcm-seal-keyed-context-\(messageSize)", configuration: aeadConfiguration) { benchmark in
+            let context = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+            let nonce = AES.GCM.Nonce()
+            let message = Data(repeating: 0x2A, count: messageSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try context.seal(message, nonce: nonce))
+            }
+        }
+
+        Benchmark("aes-gcm-seal-into-buffer-\(messageSize)", configuration: aeadConfiguration) { benchmark in
+            let context = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+            let nonce = AES.GCM.Nonce()
+            let message = Data(repeating: 0x2A, count: messageSize)
+            let output = UnsafeMutableRawBufferPointer.allocate(byteCount: messageSize + 16, alignment: 1)
+            defer { output.deallocate() }
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try context.seal(message, nonce: nonce, authenticating: Data(), into: output))
+            }
+        }
+
+        Benchmark("chachapoly-seal-per-call-\(messageSize)", configuration: aeadConfiguration) { benchmark in
+            let key = SymmetricKey(size: .bits256)
+            let nonce = ChaChaPoly.Nonce()
+            let message = Data(repeating: 0x2A, count: messageSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try ChaChaPoly.seal(message, using: key, nonce: nonce))
+            }
+        }
+
+        Benchmark("chachapoly-seal-keyed-context-\(messageSize)", configuration: aeadConfiguration) { benchmark in
+            let context = try ChaChaPoly._KeyedContext(key: SymmetricKey(size: .bits256))
+            let nonce = ChaChaPoly.Nonce()
+            let message = Data(repeating: 0x2A, count: messageSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try context.seal(message, nonce: nonce))
+            }
+        }
+
+        Benchmark("chachapoly-seal-into-buffer-\(messageSize)", configuration: aeadConfiguration) { benchmark in
+            let context = try ChaChaPoly._KeyedContext(key: SymmetricKey(size: .bits256))
+            let nonce = ChaChaPoly.Nonce()
+            let message = Data(repeating: 0x2A, count: messageSize)
+            let output = UnsafeMutableRawBufferPointer.allocate(byteCount: messageSize + 16, alignment: 1)
+            defer { output.deallocate() }
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try context.seal(message, nonce: nonce, authenticating: Data(), into: output))
+            }
+        }
+    }
+
+    // Messages split across several regions, like chained network buffers. These should cost about the same as the
+    // contiguous keyed-context benchmarks above.
+    let regionCount = 8
+    func discontiguousMessage(byteCount: Int) -> DispatchData {
+        let region = [UInt8](repeating: 0x2A, count: byteCount / regionCount)
+        var message = DispatchData.empty
+        for _ in 0..<regionCount {
+            region.withUnsafeBytes { message.append(DispatchData(bytes: $0)) }
+        }
+        return message
+    }
+
+    for messageSize in [1024, 16384] {
+        Benchmark(
+            "aes-gcm-seal-keyed-context-\(messageSize)-\(regionCount)-regions",
+            configuration: aeadConfiguration
+        ) { benchmark in
+            let context = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+            let nonce = AES.GCM.Nonce()
+            let message = discontiguousMessage(byteCount: messageSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try context.seal(message, nonce: nonce))
+            }
+        }
+
+        Benchmark(
+            "chachapoly-seal-keyed-context-\(messageSize)-\(regionCount)-regions",
+            configuration: aeadConfiguration
+        ) { benchmark in
+            let context = try ChaChaPoly._KeyedContext(key: SymmetricKey(size: .bits256))
+            let nonce = ChaChaPoly.Nonce()
+            let message = discontiguousMessage(byteCount: messageSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try context.seal(message, nonce: nonce))
+            }
+        }
+    }
+
+    // Each iteration seals one burst of MTU-sized packets in place, so packets/sec is the throughput times the burst
+    // size.
+    let burstSize = 64
+    let packetSize = 1200
+    let nonces = (0..<burstSize).map { _ in Array(AES.GCM.Nonce()) }
+
+    Benchmark("aes-gcm-seal-burst-per-packet-\(burstSize)x\(packetSize)", configuration: aeadConfiguration) { benchmark in
+        let context = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+        let gcmNonces = try nonces.map { try AES.GCM.Nonce(data: $0) }
+        let packets = UnsafeMutableRawBufferPointer.allocate(byteCount: burstSize * (packetSize + 16), alignment: 16)
+        defer { packets.deallocate() }
+        packets.initializeMemory(as: UInt8.self, repeating: 0x2A)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            for index in 0..<burstSize {
+                let packet = UnsafeMutableRawBufferPointer(
+                    rebasing: packets[(index * (packetSize + 16))..<((index + 1) * (packetSize + 16))]
+                )
+                blackHole(
+                    try context.seal(
+                        UnsafeRawBufferPointer(rebasing: packet[..<packetSize]),
+                        nonce: gcmNonces[index],
+                        authenticating: Data(),
+                        into: packet
+                    )
+                )
+            }
+        }
+    }
+
+    let hashBatchConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .one,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 100
+    )
+    let hashBatchCount = 4096
+
+    // Each iteration hashes a batch of independent messages, so messages/sec is the throughput times the batch size.
+    for messageSize in [64, 1024, 4096] {
+        let messages = (0..<hashBatchCount).map { index in
+            [UInt8](repeating: UInt8(truncatingIfNeeded: index), count: messageSize)
+        }
+
+        Benchmark("sha256-per-message-\(hashBatchCount)x\(messageSize)", configuration: hashBatchConfiguration) { benchmark in
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                for message in messages {
+                    blackHole(SHA256.hash(data: message))
+                }
+            }
+        }
+
+        Benchmark("sha256-batch-\(hashBatchCount)x\(messageSize)", configuration: hashBatchConfiguration) { benchmark in
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(SHA256._hash(batch: messages))
+            }
+        }
+    }
+
+    let digestConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .kilo,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 1000
+    )
+
+    // SHA-3 and SHAKE alongside the SHA-2 functions of the same output size, so the cost difference is visible.
+    func digestBenchmark<H: HashFunction>(_: H.Type, name: String, message: [UInt8]) {
+        Benchmark("\(name)-\(message.count)", configuration: digestConfiguration) { benchmark in
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(H.hash(data: message))
+            }
+        }
+    }
+
+    for messageSize in [64, 1024, 16384] {
+        let message = [UInt8](repeating: 0x5a, count: messageSize)
+        digestBenchmark(SHA256.self, name: "sha256", message: message)
+        digestBenchmark(SHA384.self, name: "sha384", message: message)
+        digestBenchmark(SHA512.self, name: "sha512", message: message)
+        digestBenchmark(SHA3_256.self, name: "sha3-256", message: message)
+        digestBenchmark(SHA3_384.self, name: "sha3-384", message: message)
+        digestBenchmark(SHA3_512.self, name: "sha3-512", message: message)
+        digestBenchmark(SHAKE128.self, name: "shake128", message: message)
+        digestBenchmark(SHAKE256.self, name: "shake256", message: message)
+    }
+
+    let pqConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .one,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 1000
+    )
+
+    let pqMessage = [UInt8](repeating: 0x5a, count: 64)
+
+    // Key generation and verification are dominated by expanding the public matrix from its seed with SHAKE.
+    Benchmark("mldsa65-keygen", configuration: pqConfiguration) { benchmark in
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try _CryptoExtras.MLDSA65.PrivateKey())
+        }
+    }
+
+    Benchmark("mldsa65-sign", configuration: pqConfiguration) { benchmark in
+        let key = try _CryptoExtras.MLDSA65.PrivateKey()
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try key.signature(for: pqMessage))
+        }
+    }
+
+    Benchmark("mldsa65-verify", configuration: pqConfiguration) { benchmark in
+        let key = try _CryptoExtras.MLDSA65.PrivateKey()
+        let publicKey = key.publicKey
+        let signature = try key.signature(for: pqMessage)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.isValidSignature(signature, for: pqMessage))
+        }
+    }
+
+    Benchmark("mldsa87-keygen", configuration: pqConfiguration) { benchmark in
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try _CryptoExtras.MLDSA87.PrivateKey())
+        }
+    }
+
+    Benchmark("mldsa87-sign", configuration: pqConfiguration) { benchmark in
+        let key = try _CryptoExtras.MLDSA87.PrivateKey()
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try key.signature(for: pqMessage))
+        }
+    }
+
+    Benchmark("mldsa87-verify", configuration: pqConfiguration) { benchmark in
+        let key = try _CryptoExtras.MLDSA87.PrivateKey()
+        let publicKey = key.publicKey
+        let signature = try key.signature(for: pqMessage)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.isValidSignature(signature, for: pqMessage))
+        }
+    }
+
+    Benchmark("mlkem768-keygen", configuration: pqConfiguration) { benchmark in
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(_CryptoExtras.MLKEM768.PrivateKey())
+        }
+    }
+
+    Benchmark("mlkem768-encapsulate", configuration: pqConfiguration) { benchmark in
+        let publicKey = _CryptoExtras.MLKEM768.PrivateKey().publicKey
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.encapsulate())
+        }
+    }
+
+    Benchmark("mlkem768-decapsulate", configuration: pqConfiguration) { benchmark in
+        let key = _CryptoExtras.MLKEM768.PrivateKey()
+        let encapsulated = key.publicKey.encapsulate().encapsulated
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try key.decapsulate(encapsulated))
+        }
+    }
+
+    Benchmark("mlkem1024-keygen", configuration: pqConfiguration) { benchmark in
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(_CryptoExtras.MLKEM1024.PrivateKey())
+        }
+    }
+
+    Benchmark("mlkem1024-encapsulate", configuration: pqConfiguration) { benchmark in
+        let publicKey = _CryptoExtras.MLKEM1024.PrivateKey().publicKey
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(publicKey.encapsulate())
+        }
+    }
+
+    Benchmark("mlkem1024-decapsulate", configuration: pqConfiguration) { benchmark in
+        let key = _CryptoExtras.MLKEM1024.PrivateKey()
+        let encapsulated = key.publicKey.encapsulate().encapsulated
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try key.decapsulate(encapsulated))
+        }
+    }
+
+    let signatureBatchConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .one,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 100
+    )
+
+    // Each iteration verifies a batch of signatures, so signatures/sec is the throughput times the batch size.
+    //
+    // Tokens and receipts usually come from a handful of issuers, so most of these batches share eight keys between
+    // them. The "distinct-keys" variant, with one key per signature, can't share any tables.
+    for batchSize in [1, 16, 256, 1024] {
+        func makeP256Batch(keyCount: Int) throws -> [(
+            signature: P256.Signing.ECDSASignature, data: [UInt8], publicKey: P256.Signing.PublicKey
+        )] {
+            let keys = (0..<keyCount).map { _ in P256.Signing.PrivateKey() }
+            return try (0..<batchSize).map { index in
+                let key = keys[index % keyCount]
+                let message = [UInt8](repeating: UInt8(truncatingIfNeeded: index), count: 64)
+                return (signature: try key.signature(for: message), data: message, publicKey: key.publicKey)
+            }
+        }
+
+        Benchmark(
+            "ecdsa-verify-p256-individually-\(batchSize)",
+            configuration: signatureBatchConfiguration
+        ) { benchmark in
+            let batch = try makeP256Batch(keyCount: min(batchSize, 8))
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                for item in batch {
+                    blackHole(item.publicKey.isValidSignature(item.signature, for: item.data))
+                }
+            }
+        }
+
+        Benchmark("ecdsa-verify-p256-batch-\(batchSize)", configuration: signatureBatchConfiguration) { benchmark in
+            let batch = try makeP256Batch(keyCount: min(batchSize, 8))
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(P256.Signing.PublicKey._areValidSignatures(batch))
+            }
+        }
+
+        Benchmark(
+            "ecdsa-verify-p256-batch-distinct-keys-\(batchSize)",
+            configuration: signatureBatchConfiguration
+        ) { benchmark in
+            let batch = try makeP256Batch(keyCount: batchSize)
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(P256.Signing.PublicKey._areValidSignatures(batch))
+            }
+        }
+    }
+
+    // A verifier that sees tokens from about 200 issuers, and a client doing repeated key agreement with a long-lived
+    // server. Each iteration verifies 1024 signatures, or does 1024 key agreements, so the prepared variants include
+    // the cost of preparing the keys amortized over the iterations that reuse them.
+    let hotKeyCount = 200
+    let hotKeyMessage = [UInt8](repeating: 0x5A, count: 64)
+    func makeHotKeySignatures() throws -> [(
+        signature: P256.Signing.ECDSASignature, publicKey: P256.Signing.PublicKey
+    )] {
+        let keys = (0..<hotKeyCount).map { _ in P256.Signing.PrivateKey() }
+        return try (0..<1024).map { index in
+            let key = keys[index % hotKeyCount]
+            return (signature: try key.signature(for: hotKeyMessage), publicKey: key.publicKey)
+        }
+    }
+
+    Benchmark("ecdsa-verify-p256-hot-keys-individually", configuration: signatureBatchConfiguration) { benchmark in
+        let signatures = try makeHotKeySignatures()
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            for item in signatures {
+                blackHole(item.publicKey.isValidSignature(item.signature, for: hotKeyMessage))
+            }
+        }
+    }
+
+    Benchmark("ecdsa-verify-p256-hot-keys-prepared-cache", configuration: signatureBatchConfiguration) { benchmark in
+        let signatures = try makeHotKeySignatures()
+        let cache = P256._PreparedPublicKeyCache(maximumByteCount: 32 << 20)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            for item in signatures {
+                let preparedKey = try cache.preparedKey(for: item.publicKey)
+                blackHole(preparedKey.isValidSignature(item.signature, for: hotKeyMessage))
+            }
+        }
+    }
+
+    Benchmark("ecdh-p256-long-lived-peer", configuration: signatureBatchConfiguration) { benchmark in
+        let peer = P256.KeyAgreement.PrivateKey().publicKey
+        let privateKeys = (0..<1024).map { _ in P256.KeyAgreement.PrivateKey() }
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            for privateKey in privateKeys {
+                blackHole(try privateKey.sharedSecretFromKeyAgreement(with: peer))
+            }
+        }
+    }
+
+    Benchmark("ecdh-p256-long-lived-peer-prepared", configuration: signatureBatchConfiguration) { benchmark in
+        let peer = try P256.KeyAgreement._PreparedPublicKey(P256.KeyAgreement.PrivateKey().publicKey)
+        let privateKeys = (0..<1024).map { _ in P256.KeyAgreement.PrivateKey() }
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            for privateKey in privateKeys {
+                blackHole(try privateKey._sharedSecretFromKeyAgreement(with: peer))
+            }
+        }
+    }
+
+    // ArbitraryPrecisionInteger is internal to the package. Its operations are measured on their own through
+    // _ArbitraryPrecisionIntegerBenchmark, and in context through the operations that lean on it most: RSA blind
+    // signing's client steps and hashing to a field when blinding a VOPRF input. Each iteration does one operation, so
+    // the throughput is operations per second.
+    let arbitraryPrecisionIntegerConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .kilo,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 3
+    )
+
+    let arbitraryPrecisionIntegerOperations: [(String, _ArbitraryPrecisionIntegerBenchmark.Operation)] = [
+        ("multiply", .multiply),
+        ("modular-multiply", .modularMultiply),
+        ("modular-inverse", .modularInverse),
+        ("divide", .divide),
+        ("gcd", .gcd),
+    ]
+    for bitWidth in [256, 2048] {
+        for (name, operation) in arbitraryPrecisionIntegerOperations {
+            Benchmark(
+                "arbitrary-precision-integer-\(name)-\(bitWidth)",
+                configuration: arbitraryPrecisionIntegerConfiguration
+            ) { benchmark in
+                let run = try _ArbitraryPrecisionIntegerBenchmark(operation, bitWidth: bitWidth)
+
+                benchmark.startMeasurement()
+
+                for _ in benchmark.scaledIterations {
+                    try run()
+                }
+            }
+        }
+    }
+
+    Benchmark(
+        "arbitrary-precision-integer-rsa-blind-2048",
+        configuration: arbitraryPrecisionIntegerConfiguration
+    ) { benchmark in
+        let privateKey = try _RSA.BlindSigning.PrivateKey<SHA384>(keySize: .bits2048)
+        let publicKey = privateKey.publicKey
+        let message = publicKey.prepare(Data("This is some input data".utf8))
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try publicKey.blind(message))
+        }
+    }
+
+    Benchmark(
+        "arbitrary-precision-integer-rsa-finalize-2048",
+        configuration: arbitraryPrecisionIntegerConfiguration
+    ) { benchmark in
+        let privateKey = try _RSA.BlindSigning.PrivateKey<SHA384>(keySize: .bits2048)
+        let publicKey = privateKey.publicKey
+        let message = publicKey.prepare(Data("This is some input data".utf8))
+        let blindingResult = try publicKey.blind(message)
+        let blindSignature = try privateKey.blindSignature(for: blindingResult.blindedMessage)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try publicKey.finalize(blindSignature, for: message, blindingInverse: blindingResult.inverse))
+        }
+    }
+
+    Benchmark(
+        "arbitrary-precision-integer-voprf-blind-p384",
+        configuration: arbitraryPrecisionIntegerConfiguration
+    ) { benchmark in
+        let publicKey = P384._VOPRF.PrivateKey().publicKey
+        let privateInput = Data("This is some input data".utf8)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try publicKey.blind(privateInput))
+        }
+    }
+
+    // Password hashing parameters around the common N = 2^14, r = 8. The concurrent variant processes the p blocks on
+    // up to p threads, so it should match the sequential one at p = 1 and pull ahead as p grows.
+    let scryptConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.wallClock, .throughput],
+        scalingFactor: .one,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 10
+    )
+
+    for (rounds, blockSize) in [(1 << 10, 8), (1 << 12, 8), (1 << 14, 8), (1 << 14, 1)] {
+        for parallelism in [1, 4, 16] {
+            let name = "scrypt-n\(rounds)-r\(blockSize)-p\(parallelism)"
+            let password = Array("correct horse battery staple".utf8)
+            let salt = Array("0123456789abcdef".utf8)
+
+            Benchmark(name, configuration: scryptConfiguration) { benchmark in
+                for _ in benchmark.scaledIterations {
+                    blackHole(
+                        try KDF.Scrypt.deriveKey(
+                            from: password,
+                            salt: salt,
+                            outputByteCount: 32,
+                            rounds: rounds,
+                            blockSize: blockSize,
+                            parallelism: parallelism
+                        )
+                    )
+                }
+            }
+
+            Benchmark("\(name)-concurrent", configuration: scryptConfiguration) { benchmark in
+                for _ in benchmark.scaledIterations {
+                    blackHole(
+                        try KDF.Scrypt._deriveKey(
+                            from: password,
+                            salt: salt,
+                            outputByteCount: 32,
+                            rounds: rounds,
+                            blockSize: blockSize,
+                            parallelism: parallelism,
+                            maxThreadCount: parallelism
+                        )
+                    )
+                }
+            }
+        }
+    }
+
+    // Each benchmark iteration runs a million PBKDF2 iterations in all, so that throughput is reported in PBKDF2
+    // iterations per second.
+    let pbkdf2Configuration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.wallClock, .throughput],
+        scalingFactor: .mega,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 10
+    )
+
+    for (hashName, hashFunction) in [
+        ("sha1", KDF.Insecure.PBKDF2.HashFunction.insecureSHA1),
+        ("sha256", .sha256),
+        ("sha512", .sha512),
+    ] {
+        let password = Array("correct horse battery staple".utf8)
+        let salt = Array("0123456789abcdef".utf8)
+
+        Benchmark("pbkdf2-\(hashName)-iterations", configuration: pbkdf2Configuration) { benchmark in
+            blackHole(
+                try KDF.Insecure.PBKDF2.deriveKey(
+                    from: password,
+                    salt: salt,
+                    using: hashFunction,
+                    outputByteCount: 32,
+                    unsafeUncheckedRounds: benchmark.scaledIterations.count
+                )
+            )
+        }
+
+        Benchmark("pbkdf2-\(hashName)-iterations-batch-4", configuration: pbkdf2Configuration) { benchmark in
+            let batch = (0..<4).map { index in (password: password + [UInt8(index)], salt: salt) }
+            blackHole(
+                try KDF.Insecure.PBKDF2._deriveKeys(
+                    from: batch,
+                    using: hashFunction,
+                    outputByteCount: 32,
+                    unsafeUncheckedRounds: benchmark.scaledIterations.count / batch.count
+                )
+            )
+        }
+    }
+
+    // RSA private key operations are dominated by the two CRT modular exponentiations, whose speed depends on the key
+    // size and the instructions available.
+    let rsaSignConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .kilo,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 3
+    )
+
+    for keySize in [_RSA.Signing.KeySize.bits2048, .bits3072, .bits4096] {
+        Benchmark("rsa-sign-pss-\(keySize.bitCount)", configuration: rsaSignConfiguration) { benchmark in
+            let privateKey = try _RSA.Signing.PrivateKey(keySize: keySize)
+            let digest = SHA256.hash(data: Data("This is some input data".utf8))
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                blackHole(try privateKey.signature(for: digest))
+            }
+        }
+    }
+
+    // Each iteration signs once per thread with the same key, so per-iteration time stays flat as long as signing
+    // scales across cores rather than serializing on per-key state.
+    for threadCount in [1, 2, 4, 8, 16, 64] {
+        Benchmark(
+            "rsa-sign-pss-2048-parallel-\(threadCount)",
+            configuration: Benchmark.Configuration(
+                metrics: defaultMetrics + [.wallClock],
+                scalingFactor: .one,
+                maxDuration: .seconds(10_000_000),
+                maxIterations: 100
+            )
+        ) { benchmark in
+            let privateKey = try _RSA.Signing.PrivateKey(keySize: .bits2048)
+            let digest = SHA256.hash(data: Data("This is some input data".utf8))
+
+            benchmark.startMeasurement()
+
+            for _ in benchmark.scaledIterations {
+                DispatchQueue.concurrentPerform(iterations: threadCount) { _ in
+                    blackHole(try! privateKey.signature(for: digest))
+                }
+            }
+        }
+    }
+
+    // Each iteration is one token, so throughput reads as tokens per second. Batches sign a whole request per call.
+    let rsaBlindSignConfiguration = Benchmark.Configuration(
+        metrics: defaultMetrics + [.throughput],
+        scalingFactor: .kilo,
+        maxDuration: .seconds(10_000_000),
+        maxIterations: 3
+    )
+
+    Benchmark("rsa-blind-sign-2048", configuration: rsaBlindSignConfiguration) { benchmark in
+        let privateKey = try _RSA.BlindSigning.PrivateKey(keySize: .bits2048)
+        let publicKey = privateKey.publicKey
+        let blindedMessage = try publicKey.blind(publicKey.prepare(Data("This is some input data".utf8)))
+            .blindedMessage
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            blackHole(try privateKey.blindSignature(for: blindedMessage))
+        }
+    }
+
+    for batchSize in [10, 100] {
+        Benchmark("rsa-blind-sign-2048-batch-\(batchSize)", configuration: rsaBlindSignConfiguration) { benchmark in
+            let privateKey = try _RSA.BlindSigning.PrivateKey(keySize: .bits2048)
+            let publicKey = privateKey.publicKey
+            let blindedMessages = try (0..<batchSize).map {
+                try publicKey.blind(publicKey.prepare(Data("This is some input data \($0)".utf8))).blindedMessage
+            }
+
+            benchmark.startMeasurement()
+
+            for _ in stride(from: 0, to: benchmark.scaledIterations.count, by: batchSize) {
+                blackHole(try privateKey.blindSignatures(for: blindedMessages))
+            }
+        }
+    }
 }
@@ -71,3 +71,41 @@ int ECDH_compute_key(void *out, size_t out_len, const EC_POINT *pub_key,
 
   return (int)out_len;
 }
+
+int ECDH_compute_key_with_table(void *out, size_t out_len,
+                                const EC_POINT_TABLE *peer,
+                                const EC_KEY *priv_key) {
+  if (priv_key->priv_key == NULL) {
+    OPENSSL_PUT_ERROR(ECDH, ECDH_R_NO_PRIVATE_VALUE);
+    return -1;
+  }
+  const EC_SCALAR *const priv = &priv_key->priv_key->scalar;
+  const EC_GROUP *const group = EC_KEY_get0_group(priv_key);
+  if (EC_GROUP_cmp(group, peer->group, NULL) != 0) {
+    OPENSSL_PUT_ERROR(EC, EC_R_INCOMPATIBLE_OBJECTS);
+    return -1;
+  }
+
+  // As in |ec_point_mul_scalar|, check the result is on the curve to defend
+  // against fault attacks or bugs.
+  EC_JACOBIAN shared_point;
+  uint8_t buf[EC_MAX_BYTES];
+  size_t buf_len;
+  ec_public_table_mul(group, &shared_point, &peer->table, priv);
+  if (!ec_GFp_simple_is_on_curve(group, &shared_point) ||
+      !ec_get_x_coordinate_as_bytes(group, buf, &buf_len, sizeof(buf),
+                                    &shared_point)) {
+    OPENSSL_PUT_ERROR(ECDH, ECDH_R_POINT_ARITHMETIC_FAILURE);
+    return -1;
+  }
+
+  if (buf_len < out_len) {
+    out_len = buf_len;
+  }
+  OPENSSL_memcpy(out, buf, out_len);
+  if (out_len > INT_MAX) {
+    OPENSSL_PUT_ERROR(ECDH, ERR_R_OVERFLOW);
+    return -1;
+  }
+  return (int)out_len;
+}
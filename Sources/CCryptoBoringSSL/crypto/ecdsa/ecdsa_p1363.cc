@@ -37,6 +37,20 @@ int ECDSA_verify_p1363(const uint8_t *digest, size_t digest_len,
   return ecdsa_verify_fixed(digest, digest_len, sig, sig_len, eckey);
 }
 
+int ECDSA_verify_p1363_batch(uint8_t *out_valid, const uint8_t *const *digests,
+                             const size_t *digest_lens,
+                             const uint8_t *const *sigs, const size_t *sig_lens,
+                             const EC_KEY *const *keys, size_t num) {
+  return ecdsa_verify_fixed_batch(out_valid, digests, digest_lens, sigs,
+                                  sig_lens, keys, num);
+}
+
+int ECDSA_verify_p1363_with_table(const uint8_t *digest, size_t digest_len,
+                                  const uint8_t *sig, size_t sig_len,
+                                  const EC_POINT_TABLE *table) {
+  return ecdsa_verify_fixed_with_table(digest, digest_len, sig, sig_len, table);
+}
+
 size_t ECDSA_size_p1363(const EC_KEY *key) {
   if (key == NULL) {
     return 0;
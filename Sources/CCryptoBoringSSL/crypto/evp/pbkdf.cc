@@ -16,15 +16,340 @@
 
 #include <string.h>
 
+#include <CCryptoBoringSSL_digest.h>
 #include <CCryptoBoringSSL_hmac.h>
+#include <CCryptoBoringSSL_nid.h>
+#include <CCryptoBoringSSL_sha.h>
 
+#include "../fipsmodule/sha/internal.h"
 #include "../internal.h"
+#include "../sha/internal.h"
 
 
-int PKCS5_PBKDF2_HMAC(const char *password, size_t password_len,
-                      const uint8_t *salt, size_t salt_len, uint32_t iterations,
-                      const EVP_MD *digest, size_t key_len, uint8_t *out_key) {
-  // See RFC 8018, section 5.2.
+// For SHA-1 and SHA-2, PBKDF2 is computed by calling the hash's compression
+// function directly rather than through |HMAC_CTX|. HMAC's inner and outer
+// hashes each begin with a block derived from the password, so their states
+// after that block are computed once. Each later iteration then hashes a single
+// padded block with each of them.
+
+static void pbkdf2_store_state(uint8_t *out, const SHA_CTX *ctx, size_t len) {
+  for (size_t i = 0; i < len / 4; i++) {
+    CRYPTO_store_u32_be(out + 4 * i, ctx->h[i]);
+  }
+}
+
+static void pbkdf2_store_state(uint8_t *out, const SHA256_CTX *ctx,
+                               size_t len) {
+  for (size_t i = 0; i < len / 4; i++) {
+    CRYPTO_store_u32_be(out + 4 * i, ctx->h[i]);
+  }
+}
+
+static void pbkdf2_store_state(uint8_t *out, const SHA512_CTX *ctx,
+                               size_t len) {
+  for (size_t i = 0; i < len / 8; i++) {
+    CRYPTO_store_u64_be(out + 8 * i, ctx->h[i]);
+  }
+}
+
+// pbkdf2_hmac_midstates sets |*inner| and |*outer| to the states of HMAC's
+// inner and outer hashes after the block derived from |password|.
+template <typename Ctx, int (*Init)(Ctx *),
+          int (*Update)(Ctx *, const void *, size_t),
+          int (*Final)(uint8_t *, Ctx *), size_t kBlockSize>
+static void pbkdf2_hmac_midstates(Ctx *inner, Ctx *outer, const char *password,
+                                  size_t password_len) {
+  // HMAC hashes keys that are longer than a block.
+  uint8_t key[kBlockSize] = {0};
+  if (password_len > kBlockSize) {
+    Ctx ctx;
+    Init(&ctx);
+    Update(&ctx, password, password_len);
+    Final(key, &ctx);
+    OPENSSL_cleanse(&ctx, sizeof(ctx));
+  } else {
+    OPENSSL_memcpy(key, password, password_len);
+  }
+
+  uint8_t pad[kBlockSize];
+  for (size_t i = 0; i < kBlockSize; i++) {
+    pad[i] = key[i] ^ 0x36;
+  }
+  Init(inner);
+  Update(inner, pad, kBlockSize);
+  for (size_t i = 0; i < kBlockSize; i++) {
+    pad[i] = key[i] ^ 0x5c;
+  }
+  Init(outer);
+  Update(outer, pad, kBlockSize);
+
+  OPENSSL_cleanse(key, sizeof(key));
+  OPENSSL_cleanse(pad, sizeof(pad));
+}
+
+// pbkdf2_hmac_first sets |out| to U_1 for output block |i|, the HMAC of |salt|
+// followed by |i|, given the midstates from |pbkdf2_hmac_midstates|.
+template <typename Ctx, int (*Update)(Ctx *, const void *, size_t),
+          int (*Final)(uint8_t *, Ctx *), size_t kMdLen>
+static void pbkdf2_hmac_first(uint8_t out[kMdLen], const Ctx *inner,
+                              const Ctx *outer, const uint8_t *salt,
+                              size_t salt_len, uint32_t i) {
+  uint8_t i_buf[4];
+  CRYPTO_store_u32_be(i_buf, i);
+  Ctx ctx = *inner;
+  Update(&ctx, salt, salt_len);
+  Update(&ctx, i_buf, sizeof(i_buf));
+  Final(out, &ctx);
+  ctx = *outer;
+  Update(&ctx, out, kMdLen);
+  Final(out, &ctx);
+  OPENSSL_cleanse(&ctx, sizeof(ctx));
+}
+
+template <typename Ctx, int (*Init)(Ctx *),
+          int (*Update)(Ctx *, const void *, size_t),
+          int (*Final)(uint8_t *, Ctx *),
+          void (*Transform)(Ctx *, const uint8_t *), size_t kBlockSize,
+          size_t kMdLen>
+static void pbkdf2_hmac_direct(const char *password, size_t password_len,
+                               const uint8_t *salt, size_t salt_len,
+                               uint32_t iterations, size_t key_len,
+                               uint8_t *out_key) {
+  Ctx ctx, inner, outer;
+  pbkdf2_hmac_midstates<Ctx, Init, Update, Final, kBlockSize>(
+      &inner, &outer, password, password_len);
+
+  // From the second iteration on, the inner and outer hashes each hash a
+  // |kMdLen|-byte message after the password block. |block| holds that message
+  // followed by its padding, and the length fills its last eight bytes.
+  uint8_t block[kBlockSize] = {0};
+  block[kMdLen] = 0x80;
+  CRYPTO_store_u64_be(block + kBlockSize - 8, (kBlockSize + kMdLen) * 8);
+
+  uint8_t acc[kMdLen];
+  for (uint32_t i = 1; key_len > 0; i++) {
+    pbkdf2_hmac_first<Ctx, Update, Final, kMdLen>(block, &inner, &outer, salt,
+                                                  salt_len, i);
+    OPENSSL_memcpy(acc, block, kMdLen);
+
+    // Compute the remaining U_* values and XOR.
+    for (uint32_t j = 1; j < iterations; j++) {
+      OPENSSL_memcpy(ctx.h, inner.h, sizeof(ctx.h));
+      Transform(&ctx, block);
+      pbkdf2_store_state(block, &ctx, kMdLen);
+      OPENSSL_memcpy(ctx.h, outer.h, sizeof(ctx.h));
+      Transform(&ctx, block);
+      pbkdf2_store_state(block, &ctx, kMdLen);
+      for (size_t k = 0; k < kMdLen; k++) {
+        acc[k] ^= block[k];
+      }
+    }
+
+    size_t todo = key_len < kMdLen ? key_len : kMdLen;
+    OPENSSL_memcpy(out_key, acc, todo);
+    key_len -= todo;
+    out_key += todo;
+  }
+
+  OPENSSL_cleanse(block, sizeof(block));
+  OPENSSL_cleanse(acc, sizeof(acc));
+  OPENSSL_cleanse(&ctx, sizeof(ctx));
+  OPENSSL_cleanse(&inner, sizeof(inner));
+  OPENSSL_cleanse(&outer, sizeof(outer));
+}
+
+#if defined(SHA256_X4)
+
+// With SSE2 or NEON, PBKDF2-HMAC-SHA256 can also run four independent chains of
+// iterations at once, one in each 32-bit lane of a vector. A chain computes one
+// output block of one key, so the lanes are filled by keys longer than a single
+// SHA-256 output or by |PKCS5_PBKDF2_HMAC_batch|. See |sha256_x4_worthwhile|.
+
+// A pbkdf2_sha256_chain holds the computation of one output block of
+// PBKDF2-HMAC-SHA256: the HMAC midstates, the latest U value, and the XOR of
+// the U values so far.
+struct pbkdf2_sha256_chain {
+  uint32_t inner[8];
+  uint32_t outer[8];
+  uint32_t u[8];
+  uint32_t acc[8];
+};
+
+static void pbkdf2_sha256_chain_init(pbkdf2_sha256_chain *chain,
+                                     const char *password, size_t password_len,
+                                     const uint8_t *salt, size_t salt_len,
+                                     uint32_t i) {
+  SHA256_CTX inner, outer;
+  pbkdf2_hmac_midstates<SHA256_CTX, SHA256_Init, SHA256_Update, SHA256_Final,
+                        SHA256_CBLOCK>(&inner, &outer, password,
+                                       password_len);
+  uint8_t u[SHA256_DIGEST_LENGTH];
+  pbkdf2_hmac_first<SHA256_CTX, SHA256_Update, SHA256_Final,
+                    SHA256_DIGEST_LENGTH>(u, &inner, &outer, salt, salt_len,
+                                          i);
+  OPENSSL_memcpy(chain->inner, inner.h, sizeof(chain->inner));
+  OPENSSL_memcpy(chain->outer, outer.h, sizeof(chain->outer));
+  for (size_t k = 0; k < 8; k++) {
+    chain->u[k] = chain->acc[k] = CRYPTO_load_u32_be(u + 4 * k);
+  }
+  OPENSSL_cleanse(&inner, sizeof(inner));
+  OPENSSL_cleanse(&outer, sizeof(outer));
+  OPENSSL_cleanse(u, sizeof(u));
+}
+
+// pbkdf2_sha256_chain_run runs the remaining |iterations| - 1 iterations of
+// |chain| on its own.
+static void pbkdf2_sha256_chain_run(pbkdf2_sha256_chain *chain,
+                                    uint32_t iterations) {
+  uint8_t block[SHA256_CBLOCK] = {0};
+  block[SHA256_DIGEST_LENGTH] = 0x80;
+  CRYPTO_store_u64_be(block + SHA256_CBLOCK - 8,
+                      (SHA256_CBLOCK + SHA256_DIGEST_LENGTH) * 8);
+  uint32_t h[8];
+  for (uint32_t j = 1; j < iterations; j++) {
+    for (size_t k = 0; k < 8; k++) {
+      CRYPTO_store_u32_be(block + 4 * k, chain->u[k]);
+    }
+    OPENSSL_memcpy(h, chain->inner, sizeof(h));
+    SHA256_TransformBlocks(h, block, 1);
+    for (size_t k = 0; k < 8; k++) {
+      CRYPTO_store_u32_be(block + 4 * k, h[k]);
+    }
+    OPENSSL_memcpy(h, chain->outer, sizeof(h));
+    SHA256_TransformBlocks(h, block, 1);
+    for (size_t k = 0; k < 8; k++) {
+      chain->u[k] = h[k];
+      chain->acc[k] ^= h[k];
+    }
+  }
+  OPENSSL_cleanse(block, sizeof(block));
+  OPENSSL_cleanse(h, sizeof(h));
+}
+
+// pbkdf2_sha256_chain_run_x4 runs the remaining |iterations| - 1 iterations of
+// four chains at once. The same chain may be passed more than once to fill
+// unused lanes.
+static void pbkdf2_sha256_chain_run_x4(pbkdf2_sha256_chain *const chains[4],
+                                       uint32_t iterations) {
+  sha256_vec_t inner[8], outer[8], u[8], acc[8], state[8], w[16];
+  for (size_t k = 0; k < 8; k++) {
+    inner[k] = sha256_vec_set(chains[0]->inner[k], chains[1]->inner[k],
+                              chains[2]->inner[k], chains[3]->inner[k]);
+    outer[k] = sha256_vec_set(chains[0]->outer[k], chains[1]->outer[k],
+                              chains[2]->outer[k], chains[3]->outer[k]);
+    u[k] = sha256_vec_set(chains[0]->u[k], chains[1]->u[k], chains[2]->u[k],
+                          chains[3]->u[k]);
+  }
+  for (size_t k = 0; k < 8; k++) {
+    acc[k] = u[k];
+  }
+
+  for (uint32_t j = 1; j < iterations; j++) {
+    // The message of both hashes is the previous output followed by padding for
+    // a 96-byte message.
+    for (size_t k = 0; k < 8; k++) {
+      state[k] = inner[k];
+      w[k] = u[k];
+    }
+    w[8] = sha256_vec_dup(0x80000000);
+    for (size_t k = 9; k < 15; k++) {
+      w[k] = sha256_vec_dup(0);
+    }
+    w[15] = sha256_vec_dup((SHA256_CBLOCK + SHA256_DIGEST_LENGTH) * 8);
+    sha256_x4_block(state, w);
+
+    for (size_t k = 0; k < 8; k++) {
+      w[k] = state[k];
+      state[k] = outer[k];
+    }
+    w[8] = sha256_vec_dup(0x80000000);
+    for (size_t k = 9; k < 15; k++) {
+      w[k] = sha256_vec_dup(0);
+    }
+    w[15] = sha256_vec_dup((SHA256_CBLOCK + SHA256_DIGEST_LENGTH) * 8);
+    sha256_x4_block(state, w);
+
+    for (size_t k = 0; k < 8; k++) {
+      u[k] = state[k];
+      acc[k] = sha256_vec_xor(acc[k], state[k]);
+    }
+  }
+
+  for (size_t k = 0; k < 8; k++) {
+    uint32_t words[4];
+    sha256_vec_store(words, acc[k]);
+    for (size_t lane = 0; lane < 4; lane++) {
+      chains[lane]->acc[k] = words[lane];
+    }
+  }
+  OPENSSL_cleanse(inner, sizeof(inner));
+  OPENSSL_cleanse(outer, sizeof(outer));
+  OPENSSL_cleanse(u, sizeof(u));
+  OPENSSL_cleanse(acc, sizeof(acc));
+  OPENSSL_cleanse(state, sizeof(state));
+  OPENSSL_cleanse(w, sizeof(w));
+}
+
+// pbkdf2_sha256_lanes derives |num| keys of |key_len| bytes each with
+// PBKDF2-HMAC-SHA256, as described for |PKCS5_PBKDF2_HMAC_batch|. Output blocks
+// are computed four at a time, and groups of fewer than three are computed
+// serially.
+static void pbkdf2_sha256_lanes(const char *const *passwords,
+                                const size_t *password_lens,
+                                const uint8_t *const *salts,
+                                const size_t *salt_lens, size_t num,
+                                uint32_t iterations, size_t key_len,
+                                uint8_t *out_keys) {
+  if (key_len == 0) {
+    return;
+  }
+  const size_t blocks_per_key =
+      (key_len + SHA256_DIGEST_LENGTH - 1) / SHA256_DIGEST_LENGTH;
+  const size_t num_chains = num * blocks_per_key;
+  pbkdf2_sha256_chain chains[4];
+  for (size_t start = 0; start < num_chains; start += 4) {
+    size_t todo = num_chains - start < 4 ? num_chains - start : 4;
+    for (size_t c = 0; c < todo; c++) {
+      size_t item = (start + c) / blocks_per_key;
+      size_t block = (start + c) % blocks_per_key;
+      pbkdf2_sha256_chain_init(&chains[c], passwords[item],
+                               password_lens[item], salts[item],
+                               salt_lens[item], (uint32_t)(block + 1));
+    }
+
+    if (todo >= 3) {
+      pbkdf2_sha256_chain *const lanes[4] = {&chains[0], &chains[1],
+                                             &chains[2], &chains[todo - 1]};
+      pbkdf2_sha256_chain_run_x4(lanes, iterations);
+    } else {
+      for (size_t c = 0; c < todo; c++) {
+        pbkdf2_sha256_chain_run(&chains[c], iterations);
+      }
+    }
+
+    for (size_t c = 0; c < todo; c++) {
+      size_t item = (start + c) / blocks_per_key;
+      size_t offset = ((start + c) % blocks_per_key) * SHA256_DIGEST_LENGTH;
+      uint8_t out[SHA256_DIGEST_LENGTH];
+      for (size_t k = 0; k < 8; k++) {
+        CRYPTO_store_u32_be(out + 4 * k, chains[c].acc[k]);
+      }
+      size_t len = key_len - offset < SHA256_DIGEST_LENGTH
+                       ? key_len - offset
+                       : SHA256_DIGEST_LENGTH;
+      OPENSSL_memcpy(out_keys + item * key_len + offset, out, len);
+      OPENSSL_cleanse(out, sizeof(out));
+    }
+  }
+  OPENSSL_cleanse(chains, sizeof(chains));
+}
+
+#endif  // SHA256_X4
+
+static int pbkdf2_hmac_generic(const char *password, size_t password_len,
+                               const uint8_t *salt, size_t salt_len,
+                               uint32_t iterations, const EVP_MD *digest,
+                               size_t key_len, uint8_t *out_key) {
   bssl::ScopedHMAC_CTX hctx;
   if (!HMAC_Init_ex(hctx.get(), password, password_len, digest, NULL)) {
     return 0;
@@ -71,6 +396,70 @@ int PKCS5_PBKDF2_HMAC(const char *password, size_t password_len,
     i++;
   }
 
+  return 1;
+}
+
+static int pbkdf2_hmac(const char *password, size_t password_len,
+                       const uint8_t *salt, size_t salt_len,
+                       uint32_t iterations, const EVP_MD *digest,
+                       size_t key_len, uint8_t *out_key) {
+  switch (EVP_MD_type(digest)) {
+    case NID_sha1:
+      pbkdf2_hmac_direct<SHA_CTX, SHA1_Init, SHA1_Update, SHA1_Final,
+                         SHA1_Transform, SHA_CBLOCK, SHA_DIGEST_LENGTH>(
+          password, password_len, salt, salt_len, iterations, key_len,
+          out_key);
+      return 1;
+    case NID_sha224:
+      pbkdf2_hmac_direct<SHA256_CTX, SHA224_Init, SHA224_Update, SHA224_Final,
+                         SHA256_Transform, SHA256_CBLOCK,
+                         SHA224_DIGEST_LENGTH>(password, password_len, salt,
+                                               salt_len, iterations, key_len,
+                                               out_key);
+      return 1;
+    case NID_sha256:
+#if defined(SHA256_X4)
+      if (key_len > 2 * SHA256_DIGEST_LENGTH && sha256_x4_worthwhile()) {
+        pbkdf2_sha256_lanes(&password, &password_len, &salt, &salt_len, 1,
+                            iterations, key_len, out_key);
+        return 1;
+      }
+#endif
+      pbkdf2_hmac_direct<SHA256_CTX, SHA256_Init, SHA256_Update, SHA256_Final,
+                         SHA256_Transform, SHA256_CBLOCK,
+                         SHA256_DIGEST_LENGTH>(password, password_len, salt,
+                                               salt_len, iterations, key_len,
+                                               out_key);
+      return 1;
+    case NID_sha384:
+      pbkdf2_hmac_direct<SHA512_CTX, SHA384_Init, SHA384_Update, SHA384_Final,
+                         SHA512_Transform, SHA512_CBLOCK,
+                         SHA384_DIGEST_LENGTH>(password, password_len, salt,
+                                               salt_len, iterations, key_len,
+                                               out_key);
+      return 1;
+    case NID_sha512:
+      pbkdf2_hmac_direct<SHA512_CTX, SHA512_Init, SHA512_Update, SHA512_Final,
+                         SHA512_Transform, SHA512_CBLOCK,
+                         SHA512_DIGEST_LENGTH>(password, password_len, salt,
+                                               salt_len, iterations, key_len,
+                                               out_key);
+      return 1;
+    default:
+      return pbkdf2_hmac_generic(password, password_len, salt, salt_len,
+                                 iterations, digest, key_len, out_key);
+  }
+}
+
+int PKCS5_PBKDF2_HMAC(const char *password, size_t password_len,
+                      const uint8_t *salt, size_t salt_len, uint32_t iterations,
+                      const EVP_MD *digest, size_t key_len, uint8_t *out_key) {
+  // See RFC 8018, section 5.2.
+  if (!pbkdf2_hmac(password, password_len, salt, salt_len, iterations, digest,
+                   key_len, out_key)) {
+    return 0;
+  }
+
   // RFC 8018 describes iterations (c) as being a "positive integer", so a
   // value of 0 is an error.
   //
@@ -89,6 +478,32 @@ int PKCS5_PBKDF2_HMAC(const char *password, size_t password_len,
   return 1;
 }
 
+int PKCS5_PBKDF2_HMAC_batch(const char *const *passwords,
+                            const size_t *password_lens,
+                            const uint8_t *const *salts,
+                            const size_t *salt_lens, size_t num,
+                            uint32_t iterations, const EVP_MD *digest,
+                            size_t key_len, uint8_t *out_keys) {
+#if defined(SHA256_X4)
+  if (EVP_MD_type(digest) == NID_sha256 && sha256_x4_worthwhile()) {
+    pbkdf2_sha256_lanes(passwords, password_lens, salts, salt_lens, num,
+                        iterations, key_len, out_keys);
+    // See |PKCS5_PBKDF2_HMAC| for why zero iterations still produce keys.
+    return iterations != 0;
+  }
+#endif
+
+  int ret = 1;
+  for (size_t i = 0; i < num; i++) {
+    if (!PKCS5_PBKDF2_HMAC(passwords[i], password_lens[i], salts[i],
+                           salt_lens[i], iterations, digest, key_len,
+                           out_keys + i * key_len)) {
+      ret = 0;
+    }
+  }
+  return ret;
+}
+
 int PKCS5_PBKDF2_HMAC_SHA1(const char *password, size_t password_len,
                            const uint8_t *salt, size_t salt_len,
                            uint32_t iterations, size_t key_len,
@@ -21,6 +21,14 @@
 
 #include "../internal.h"
 
+#if defined(OPENSSL_SSE2)
+#include <emmintrin.h>
+#define SCRYPT_VECTOR_SALSA
+#elif (defined(OPENSSL_ARM) || defined(OPENSSL_AARCH64)) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SCRYPT_VECTOR_SALSA
+#endif
+
 
 // This file implements scrypt, described in RFC 7914.
 //
@@ -38,6 +46,138 @@ typedef struct {
 
 static_assert(sizeof(block_t) == 64, "block_t has padding");
 
+#if defined(SCRYPT_VECTOR_SALSA)
+
+// With SSE2 or NEON, each Salsa20 block is kept with its words permuted so that
+// the diagonals of the 4x4 matrix are contiguous, as in Colin Percival's SSE2
+// implementation. Row i of the permuted block then holds words 4*i, 4*i+5,
+// 4*i+10 and 4*i+15 (mod 16) and the core works on whole rows. Word zero, which
+// |scryptROMix| reads to pick the next block, stays in place.
+//
+// XOR and copies don't depend on the order of the words, so only the core and
+// the conversions at either end of |scryptROMix| need to know about this.
+
+#if defined(OPENSSL_SSE2)
+typedef __m128i salsa_vec_t;
+
+static inline salsa_vec_t salsa_vec_load(const uint32_t *in) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+}
+
+static inline void salsa_vec_store(uint32_t *out, salsa_vec_t v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+}
+
+static inline salsa_vec_t salsa_vec_add(salsa_vec_t a, salsa_vec_t b) {
+  return _mm_add_epi32(a, b);
+}
+
+// salsa_vec_xor_rotl returns |x| XOR (|v| rotated left by |kShift| bits).
+template <int kShift>
+static inline salsa_vec_t salsa_vec_xor_rotl(salsa_vec_t x, salsa_vec_t v) {
+  x = _mm_xor_si128(x, _mm_slli_epi32(v, kShift));
+  return _mm_xor_si128(x, _mm_srli_epi32(v, 32 - kShift));
+}
+
+// salsa_vec_rotate_lanes returns |v| with lane i set to lane i + |kLanes|
+// (mod 4).
+template <int kLanes>
+static inline salsa_vec_t salsa_vec_rotate_lanes(salsa_vec_t v) {
+  static_assert(kLanes >= 1 && kLanes <= 3, "invalid rotation");
+  return _mm_shuffle_epi32(v, kLanes == 1   ? 0x39
+                              : kLanes == 2 ? 0x4e
+                                            : 0x93);
+}
+#else
+typedef uint32x4_t salsa_vec_t;
+
+static inline salsa_vec_t salsa_vec_load(const uint32_t *in) {
+  return vld1q_u32(in);
+}
+
+static inline void salsa_vec_store(uint32_t *out, salsa_vec_t v) {
+  vst1q_u32(out, v);
+}
+
+static inline salsa_vec_t salsa_vec_add(salsa_vec_t a, salsa_vec_t b) {
+  return vaddq_u32(a, b);
+}
+
+template <int kShift>
+static inline salsa_vec_t salsa_vec_xor_rotl(salsa_vec_t x, salsa_vec_t v) {
+  return veorq_u32(x, vsriq_n_u32(vshlq_n_u32(v, kShift), v, 32 - kShift));
+}
+
+template <int kLanes>
+static inline salsa_vec_t salsa_vec_rotate_lanes(salsa_vec_t v) {
+  static_assert(kLanes >= 1 && kLanes <= 3, "invalid rotation");
+  return vextq_u32(v, v, kLanes);
+}
+#endif
+
+// salsa208 implements the Salsa20/8 core function, as
+// |salsa208_word_specification| in the portable build does, on a block in the
+// permuted order described above. It modifies the block at |inout| in-place.
+static void salsa208(block_t *inout) {
+  salsa_vec_t x0 = salsa_vec_load(&inout->words[0]);
+  salsa_vec_t x1 = salsa_vec_load(&inout->words[4]);
+  salsa_vec_t x2 = salsa_vec_load(&inout->words[8]);
+  salsa_vec_t x3 = salsa_vec_load(&inout->words[12]);
+  const salsa_vec_t in0 = x0, in1 = x1, in2 = x2, in3 = x3;
+
+  for (int i = 8; i > 0; i -= 2) {
+    // Columns.
+    x1 = salsa_vec_xor_rotl<7>(x1, salsa_vec_add(x0, x3));
+    x2 = salsa_vec_xor_rotl<9>(x2, salsa_vec_add(x1, x0));
+    x3 = salsa_vec_xor_rotl<13>(x3, salsa_vec_add(x2, x1));
+    x0 = salsa_vec_xor_rotl<18>(x0, salsa_vec_add(x3, x2));
+
+    x1 = salsa_vec_rotate_lanes<3>(x1);
+    x2 = salsa_vec_rotate_lanes<2>(x2);
+    x3 = salsa_vec_rotate_lanes<1>(x3);
+
+    // Rows.
+    x3 = salsa_vec_xor_rotl<7>(x3, salsa_vec_add(x0, x1));
+    x2 = salsa_vec_xor_rotl<9>(x2, salsa_vec_add(x3, x0));
+    x1 = salsa_vec_xor_rotl<13>(x1, salsa_vec_add(x2, x3));
+    x0 = salsa_vec_xor_rotl<18>(x0, salsa_vec_add(x1, x2));
+
+    x1 = salsa_vec_rotate_lanes<1>(x1);
+    x2 = salsa_vec_rotate_lanes<2>(x2);
+    x3 = salsa_vec_rotate_lanes<3>(x3);
+  }
+
+  salsa_vec_store(&inout->words[0], salsa_vec_add(x0, in0));
+  salsa_vec_store(&inout->words[4], salsa_vec_add(x1, in1));
+  salsa_vec_store(&inout->words[8], salsa_vec_add(x2, in2));
+  salsa_vec_store(&inout->words[12], salsa_vec_add(x3, in3));
+}
+
+// permute_blocks converts the |num| blocks at |blocks| to the order used by
+// |salsa208|.
+static void permute_blocks(block_t *blocks, size_t num) {
+  for (size_t i = 0; i < num; i++) {
+    block_t tmp;
+    for (size_t j = 0; j < 16; j++) {
+      tmp.words[j] = blocks[i].words[(j * 5) % 16];
+    }
+    OPENSSL_memcpy(&blocks[i], &tmp, sizeof(tmp));
+  }
+}
+
+// unpermute_blocks reverses |permute_blocks|.
+static void unpermute_blocks(block_t *blocks, size_t num) {
+  for (size_t i = 0; i < num; i++) {
+    block_t tmp;
+    for (size_t j = 0; j < 16; j++) {
+      tmp.words[(j * 5) % 16] = blocks[i].words[j];
+    }
+    OPENSSL_memcpy(&blocks[i], &tmp, sizeof(tmp));
+  }
+}
+
+#else  // !SCRYPT_VECTOR_SALSA
+
 // salsa208_word_specification implements the Salsa20/8 core function, also
 // described in RFC 7914, section 3. It modifies the block at |inout|
 // in-place.
@@ -85,6 +225,14 @@ static void salsa208_word_specification(block_t *inout) {
   }
 }
 
+static void salsa208(block_t *inout) { salsa208_word_specification(inout); }
+
+static void permute_blocks(block_t *blocks, size_t num) {}
+
+static void unpermute_blocks(block_t *blocks, size_t num) {}
+
+#endif  // SCRYPT_VECTOR_SALSA
+
 // xor_block sets |*out| to be |*a| XOR |*b|.
 static void xor_block(block_t *out, const block_t *a, const block_t *b) {
   for (size_t i = 0; i < 16; i++) {
@@ -102,7 +250,7 @@ static void scryptBlockMix(block_t *out, const block_t *B, uint64_t r) {
   OPENSSL_memcpy(&X, &B[r * 2 - 1], sizeof(X));
   for (uint64_t i = 0; i < r * 2; i++) {
     xor_block(&X, &X, &B[i]);
-    salsa208_word_specification(&X);
+    salsa208(&X);
 
     // This implements the permutation in step 3.
     OPENSSL_memcpy(&out[i / 2 + (i & 1) * r], &X, sizeof(X));
@@ -116,6 +264,8 @@ static void scryptBlockMix(block_t *out, const block_t *B, uint64_t r) {
 // blocks (2 * |r| * |N| Salsa20 blocks).
 static void scryptROMix(block_t *B, uint64_t r, uint64_t N, block_t *T,
                         block_t *V) {
+  permute_blocks(B, 2 * r);
+
   // Steps 1 and 2.
   OPENSSL_memcpy(V, B, 2 * r * sizeof(block_t));
   for (uint64_t i = 1; i < N; i++) {
@@ -133,6 +283,8 @@ static void scryptROMix(block_t *B, uint64_t r, uint64_t N, block_t *T,
     }
     scryptBlockMix(B, T, r);
   }
+
+  unpermute_blocks(B, 2 * r);
 }
 
 // SCRYPT_PR_MAX is the maximum value of p * r. This is equivalent to the
@@ -147,10 +299,9 @@ static void scryptROMix(block_t *B, uint64_t r, uint64_t N, block_t *T,
 // |EVP_PBE_scrypt|.
 #define SCRYPT_MAX_MEM (1024 * 1024 * 65)
 
-int EVP_PBE_scrypt(const char *password, size_t password_len,
-                   const uint8_t *salt, size_t salt_len, uint64_t N, uint64_t r,
-                   uint64_t p, size_t max_mem, uint8_t *out_key,
-                   size_t key_len) {
+// scrypt_check_params returns one if |N|, |r|, and |p| are valid scrypt
+// parameters and zero otherwise.
+static int scrypt_check_params(uint64_t N, uint64_t r, uint64_t p) {
   if (r == 0 || p == 0 || p > SCRYPT_PR_MAX / r ||
       // |N| must be a power of two.
       N < 2 || (N & (N - 1)) ||
@@ -161,6 +312,16 @@ int EVP_PBE_scrypt(const char *password, size_t password_len,
     OPENSSL_PUT_ERROR(EVP, EVP_R_INVALID_PARAMETERS);
     return 0;
   }
+  return 1;
+}
+
+int EVP_PBE_scrypt(const char *password, size_t password_len,
+                   const uint8_t *salt, size_t salt_len, uint64_t N, uint64_t r,
+                   uint64_t p, size_t max_mem, uint8_t *out_key,
+                   size_t key_len) {
+  if (!scrypt_check_params(N, r, p)) {
+    return 0;
+  }
 
   // Determine the amount of memory needed. B, T, and V are |p|, 1, and |N|
   // scrypt blocks, respectively. Each scrypt block is 2*|r| |block_t|s.
@@ -214,3 +375,35 @@ err:
   OPENSSL_free(B);
   return ret;
 }
+
+int EVP_PBE_scrypt_romix(uint8_t *block, uint64_t N, uint64_t r) {
+  if (!scrypt_check_params(N, r, 1)) {
+    return 0;
+  }
+
+  // As in |EVP_PBE_scrypt|, B, T, and V are 1, 1, and |N| scrypt blocks. Check
+  // that the total fits in a size_t.
+  uint64_t max_scrypt_blocks = SIZE_MAX / (2 * r * sizeof(block_t));
+  if (max_scrypt_blocks < 2 || max_scrypt_blocks - 2 < N) {
+    OPENSSL_PUT_ERROR(EVP, EVP_R_MEMORY_LIMIT_EXCEEDED);
+    return 0;
+  }
+  size_t B_blocks = 2 * r;
+  size_t B_bytes = B_blocks * sizeof(block_t);
+  size_t T_blocks = 2 * r;
+  size_t V_blocks = N * 2 * r;
+  // |scryptROMix| writes all of V before reading it, so it needn't be zeroed.
+  block_t *B = reinterpret_cast<block_t *>(OPENSSL_malloc(
+      (B_blocks + T_blocks + V_blocks) * sizeof(block_t)));
+  if (B == NULL) {
+    return 0;
+  }
+
+  // |block| may not be aligned for |block_t|, so work on a copy.
+  OPENSSL_memcpy(B, block, B_bytes);
+  scryptROMix(B, r, N, B + B_blocks, B + B_blocks + T_blocks);
+  OPENSSL_memcpy(block, B, B_bytes);
+
+  OPENSSL_free(B);
+  return 1;
+}
@@ -63,6 +63,7 @@
 #include "bn/prime.cc.inc"
 #include "bn/random.cc.inc"
 #include "bn/rsaz_exp.cc.inc"
+#include "bn/rsaz_exp_ifma.cc.inc"
 #include "bn/shift.cc.inc"
 #include "bn/sqrt.cc.inc"
 #include "cipher/aead.cc.inc"
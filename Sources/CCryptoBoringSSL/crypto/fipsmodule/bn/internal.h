@@ -616,6 +616,17 @@ int bn_mod_inverse_prime(BIGNUM *out, const BIGNUM *a, const BIGNUM *p,
 int bn_mod_inverse_secret_prime(BIGNUM *out, const BIGNUM *a, const BIGNUM *p,
                                 BN_CTX *ctx, const BN_MONT_CTX *mont_p);
 
+// bn_mod_exp_mont_consttime_x2 behaves like two calls to
+// |BN_mod_exp_mont_consttime|, setting |rr1| to |a1|^|p1| mod |mont1->N| and
+// |rr2| to |a2|^|p2| mod |mont2->N|. Where the hardware and operand sizes allow,
+// the two exponentiations are interleaved, which is faster than running them
+// one after the other. It returns one on success and zero on error.
+int bn_mod_exp_mont_consttime_x2(BIGNUM *rr1, const BIGNUM *a1,
+                                 const BIGNUM *p1, const BN_MONT_CTX *mont1,
+                                 BIGNUM *rr2, const BIGNUM *a2,
+                                 const BIGNUM *p2, const BN_MONT_CTX *mont2,
+                                 BN_CTX *ctx);
+
 // BN_MONT_CTX_set_locked takes |lock| and checks whether |*pmont| is NULL. If
 // so, it creates a new |BN_MONT_CTX| and sets the modulus for it to |mod|. It
 // then stores it as |*pmont|. It returns one on success and zero on error. Note
@@ -104,6 +104,49 @@ void rsaz_1024_red2norm_avx2(BN_ULONG norm[16], const BN_ULONG red[40]);
 
 #endif  // !OPENSSL_NO_ASM && OPENSSL_X86_64
 
+#if !defined(OPENSSL_NO_ASM) && defined(OPENSSL_X86_64) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define RSAZ_IFMA_ENABLED
+
+// rsaz_ifma_capable returns one if the AVX-512 IFMA exponentiation functions
+// below may be used.
+inline int rsaz_ifma_capable(void) {
+  return CRYPTO_is_AVX512IFMA_capable() && CRYPTO_is_AVX512VL_capable();
+}
+
+// rsaz_ifma_supported_width returns one if the AVX-512 IFMA exponentiation
+// functions support moduli of |num_words| words. They support 1024-, 1536- and
+// 2048-bit moduli, the CRT halves of 2048-, 3072- and 4096-bit RSA keys, which
+// are the sizes where they were measured to beat both |RSAZ_1024_mod_exp_avx2|
+// and x86_64-mont5.pl. Where |rsaz_avx2_preferred| is true, callers still use
+// |RSAZ_1024_mod_exp_avx2| for 1024-bit moduli.
+inline int rsaz_ifma_supported_width(size_t num_words) {
+  return num_words == 16 || num_words == 24 || num_words == 32;
+}
+
+// RSAZ_mod_exp_ifma sets |result| to |base| raised to |exponent| modulo |m|,
+// where all four are |num_words| words and |num_words| is supported by
+// |rsaz_ifma_supported_width|. |base| must be fully reduced and |m| must have
+// its top bit set. |RR| and |k0| must be |RR| and |n0[0]|, respectively, from
+// |m|'s |BN_MONT_CTX|. The exponent is treated as secret. It returns one on
+// success and zero on allocation failure.
+int RSAZ_mod_exp_ifma(BN_ULONG *result, const BN_ULONG *base,
+                      const BN_ULONG *exponent, const BN_ULONG *m,
+                      const BN_ULONG *RR, BN_ULONG k0, size_t num_words);
+
+// RSAZ_mod_exp_ifma_x2 behaves like two calls to |RSAZ_mod_exp_ifma| with moduli
+// of the same size, but interleaves the two exponentiations, which is faster
+// than running them one after the other.
+int RSAZ_mod_exp_ifma_x2(BN_ULONG *result1, const BN_ULONG *base1,
+                         const BN_ULONG *exponent1, const BN_ULONG *m1,
+                         const BN_ULONG *RR1, BN_ULONG k0_1,
+                         BN_ULONG *result2, const BN_ULONG *base2,
+                         const BN_ULONG *exponent2, const BN_ULONG *m2,
+                         const BN_ULONG *RR2, BN_ULONG k0_2,
+                         size_t num_words);
+
+#endif  // !OPENSSL_NO_ASM && OPENSSL_X86_64 && (__GNUC__ || __clang__)
+
 #if defined(__cplusplus)
 }  // extern "C"
 #endif
@@ -550,6 +550,17 @@ struct ec_point_st {
   EC_JACOBIAN raw;
 } /* EC_POINT */;
 
+struct ec_point_precomp_st {
+  // group is an owning reference to |group|.
+  EC_GROUP *group;
+  // raw is the point itself, which is used when |group| cannot precompute.
+  EC_JACOBIAN raw;
+  // has_precomp is one if |precomp| holds the output of |ec_init_precomp| for
+  // |raw| and zero otherwise.
+  int has_precomp;
+  EC_PRECOMP precomp;
+} /* EC_POINT_PRECOMP */;
+
 struct ec_group_st {
   const EC_METHOD *meth;
 
@@ -624,6 +635,65 @@ int ec_GFp_mont_mul_public_batch(const EC_GROUP *group, EC_JACOBIAN *r,
                                  const EC_JACOBIAN *points,
                                  const EC_SCALAR *scalars, size_t num);
 
+// ec_mul_public_pippenger sets |r| to the sum of |points[i]| * |scalars[i]|
+// for the |num| points, using Pippenger's bucket method. Unlike
+// |ec_GFp_mont_mul_public_batch|, its cost grows sublinearly in |num|, so it is
+// faster for large batches, and it only uses the group's |add| and |dbl|
+// methods, so it works for every curve. It assumes that the inputs are public.
+// It returns one on success and zero on allocation failure.
+int ec_mul_public_pippenger(const EC_GROUP *group, EC_JACOBIAN *r,
+                            const EC_JACOBIAN *points,
+                            const EC_SCALAR *scalars, size_t num);
+
+// EC_PUBLIC_TABLE_WINDOW_BITS is the window size of an |EC_PUBLIC_TABLE|.
+#define EC_PUBLIC_TABLE_WINDOW_BITS 5
+
+// An |EC_PUBLIC_TABLE| is a table of multiples of a point, which makes
+// multiplying it several times faster than |ec_point_mul_scalar_public|, at
+// the cost of about three multiplications to build. Unlike |EC_PRECOMP|, it
+// only uses the group's |add| and |dbl| methods, so it works for every curve.
+// The point itself is public, but |ec_public_table_mul| may be used with
+// secret scalars.
+typedef struct {
+  BN_ULONG *words;
+} EC_PUBLIC_TABLE;
+
+// ec_public_table_size returns the number of bytes allocated for an
+// |EC_PUBLIC_TABLE| on |group|.
+size_t ec_public_table_size(const EC_GROUP *group);
+
+// ec_public_table_init builds |out| for |p|. It returns one on success and zero
+// on allocation failure. On success, the caller must release |out| with
+// |ec_public_table_cleanup|.
+int ec_public_table_init(const EC_GROUP *group, EC_PUBLIC_TABLE *out,
+                         const EC_JACOBIAN *p);
+
+// ec_public_table_cleanup releases the memory held by |table|.
+void ec_public_table_cleanup(EC_PUBLIC_TABLE *table);
+
+// ec_public_table_mul_vartime sets |r| to |scalar| times the point of |table|.
+// It assumes that |scalar| is public.
+void ec_public_table_mul_vartime(const EC_GROUP *group, EC_JACOBIAN *r,
+                                 const EC_PUBLIC_TABLE *table,
+                                 const EC_SCALAR *scalar);
+
+// ec_public_table_mul sets |r| to |scalar| times the point of |table|. It
+// treats |scalar| as secret, but, like |ec_point_mul_scalar|, leaks whether
+// intermediate computations add a point to itself, which is negligibly
+// unlikely for a uniformly random scalar.
+void ec_public_table_mul(const EC_GROUP *group, EC_JACOBIAN *r,
+                         const EC_PUBLIC_TABLE *table,
+                         const EC_SCALAR *scalar);
+
+// An |EC_POINT_TABLE| is the public wrapper for an |EC_PUBLIC_TABLE|.
+struct ec_point_table_st {
+  // group is an owning reference to |group|.
+  EC_GROUP *group;
+  // raw is the point of |table|.
+  EC_JACOBIAN raw;
+  EC_PUBLIC_TABLE table;
+} /* EC_POINT_TABLE */;
+
 // method functions in simple.c
 int ec_GFp_simple_group_set_curve(EC_GROUP *, const BIGNUM *p, const BIGNUM *a,
                                   const BIGNUM *b, BN_CTX *);
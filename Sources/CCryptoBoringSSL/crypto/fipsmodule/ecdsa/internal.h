@@ -54,6 +54,18 @@ int ecdsa_verify_fixed_no_self_test(const uint8_t *digest, size_t digest_len,
                                     const uint8_t *sig, size_t sig_len,
                                     const EC_KEY *key);
 
+// ecdsa_verify_fixed_batch behaves like |ECDSA_verify_p1363_batch|.
+int ecdsa_verify_fixed_batch(uint8_t *out_valid,
+                             const uint8_t *const *digests,
+                             const size_t *digest_lens,
+                             const uint8_t *const *sigs, const size_t *sig_lens,
+                             const EC_KEY *const *keys, size_t num);
+
+// ecdsa_verify_fixed_with_table behaves like |ECDSA_verify_p1363_with_table|.
+int ecdsa_verify_fixed_with_table(const uint8_t *digest, size_t digest_len,
+                                  const uint8_t *sig, size_t sig_len,
+                                  const EC_POINT_TABLE *table);
+
 
 #if defined(__cplusplus)
 }
@@ -27,6 +27,7 @@ enum boringssl_keccak_config_t : int32_t {
   boringssl_sha3_512,
   boringssl_shake128,
   boringssl_shake256,
+  boringssl_sha3_384,
 };
 
 enum boringssl_keccak_phase_t : int32_t {
@@ -76,4 +77,33 @@ OPENSSL_EXPORT void BORINGSSL_keccak_squeeze(struct BORINGSSL_keccak_st *ctx,
 }
 #endif
 
+#if defined(__cplusplus)
+BSSL_NAMESPACE_BEGIN
+
+// BORINGSSL_keccak_x4_st holds four independent SHAKE instances of the same
+// configuration, which are absorbed and squeezed in lockstep so that their
+// permutations can be computed together with vector instructions. The states
+// are interleaved: |state[i][j]| is lane |i| of instance |j|.
+struct BORINGSSL_keccak_x4_st {
+  uint64_t state[25][4];
+  size_t rate_bytes;
+  bool needs_permute;
+};
+
+// BORINGSSL_keccak_x4_init absorbs |in_len| bytes from each of |in[0]| to
+// |in[3]| into four instances of |config| and prepares them for squeezing.
+// |config| must be |boringssl_shake128| or |boringssl_shake256|.
+void BORINGSSL_keccak_x4_init(struct BORINGSSL_keccak_x4_st *ctx,
+                              enum boringssl_keccak_config_t config,
+                              const uint8_t *const in[4], size_t in_len);
+
+// BORINGSSL_keccak_x4_squeeze_block writes the next |ctx->rate_bytes| bytes of
+// output of each instance to |out[0]| to |out[3]|. This matches calling
+// |BORINGSSL_keccak_squeeze| on each instance with |ctx->rate_bytes| bytes.
+void BORINGSSL_keccak_x4_squeeze_block(struct BORINGSSL_keccak_x4_st *ctx,
+                                       uint8_t *const out[4]);
+
+BSSL_NAMESPACE_END
+#endif
+
 #endif  // OPENSSL_HEADER_CRYPTO_FIPSMODULE_KECCAK_INTERNAL_H
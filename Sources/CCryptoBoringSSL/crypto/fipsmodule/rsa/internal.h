@@ -29,6 +29,33 @@ extern "C" {
 
 typedef struct bn_blinding_st BN_BLINDING;
 
+// An |RSA| caches up to 1024 |BN_BLINDING|s, in chunks of slots that are
+// allocated as more threads use the key at once. The first chunk has
+// |RSA_BLINDING_FIRST_CHUNK| slots and each later one doubles the total, up to
+// |RSA_BLINDING_CHUNKS| chunks. When more threads than that use a key
+// concurrently, the excess create and destroy |BN_BLINDING| objects as needed,
+// which costs almost as much as a 2048-bit signature.
+#if defined(OPENSSL_TSAN)
+// Smaller under TSAN so that the edge cases can be hit with fewer threads.
+#define RSA_BLINDING_FIRST_CHUNK 1
+#define RSA_BLINDING_CHUNKS 2
+#else
+#define RSA_BLINDING_FIRST_CHUNK 16
+#define RSA_BLINDING_CHUNKS 7
+#endif
+
+// An RSA_BLINDING_SLOT is one entry in an |RSA|'s blinding cache.
+typedef struct rsa_blinding_slot_st {
+  // blinding may only be accessed by the thread that reserved the slot. It is
+  // created on first use.
+  BN_BLINDING *blinding;
+  // in_use is one while a thread has reserved this slot and zero otherwise.
+  CRYPTO_atomic_u32 in_use;
+  // Pad each slot to a cache line so threads spinning on neighbouring flags do
+  // not contend with each other.
+  uint8_t padding[64 - sizeof(BN_BLINDING *) - sizeof(CRYPTO_atomic_u32)];
+} RSA_BLINDING_SLOT;
+
 struct rsa_st {
   RSA_METHOD *meth;
 
@@ -64,20 +91,24 @@ struct rsa_st {
   // iqmp_mont is q^-1 mod p in Montgomery form, using |mont_p|.
   BIGNUM *iqmp_mont;
 
-  // num_blindings contains the size of the |blindings| and |blindings_inuse|
-  // arrays. This member and the |blindings_inuse| array are protected by
-  // |lock|.
-  size_t num_blindings;
-  // blindings is an array of BN_BLINDING structures that can be reserved by a
-  // thread by locking |lock| and changing the corresponding element in
-  // |blindings_inuse| from 0 to 1.
-  BN_BLINDING **blindings;
-  unsigned char *blindings_inuse;
-  uint64_t blinding_fork_generation;
+  // blinding_chunks holds the cached |BN_BLINDING|s. Its first
+  // |num_blinding_chunks| entries have been allocated. Each is written once,
+  // under |lock|, before |num_blinding_chunks| is increased to publish it, so
+  // the published chunks may be read without the lock. Threads then reserve a
+  // slot without taking |lock| by changing its |in_use| flag from 0 to 1. See
+  // |rsa_blinding_get|.
+  RSA_BLINDING_SLOT *blinding_chunks[RSA_BLINDING_CHUNKS];
+  CRYPTO_atomic_u32 num_blinding_chunks;
+  // blinding_fork_generation is the low 32 bits of the fork generation in
+  // which the cache was last used. It is written under |lock| but may be read
+  // without it. There is no portable 64-bit atomic, and the low bits only
+  // repeat after 2^32 nested forks.
+  CRYPTO_atomic_u32 blinding_fork_generation;
 
   // private_key_frozen is one if the key has been used for a private key
-  // operation and may no longer be mutated.
-  unsigned private_key_frozen:1;
+  // operation and may no longer be mutated. It is written under |lock| but may
+  // be read without it.
+  CRYPTO_atomic_u32 private_key_frozen;
 };
 
 
@@ -682,6 +682,7 @@ typedef enum {
   OPENSSL_THREAD_LOCAL_RAND,
   OPENSSL_THREAD_LOCAL_FIPS_COUNTERS,
   OPENSSL_THREAD_LOCAL_FIPS_SERVICE_INDICATOR_STATE,
+  OPENSSL_THREAD_LOCAL_BN_CTX,
   OPENSSL_THREAD_LOCAL_TEST,
   NUM_OPENSSL_THREAD_LOCALS,
 } thread_local_data_t;
@@ -1249,6 +1250,14 @@ inline int CRYPTO_cpu_perf_is_like_silvermont(void) {
   return !hardware_supports_xsave && CRYPTO_is_MOVBE_capable();
 }
 
+inline int CRYPTO_is_AVX512F_capable(void) {
+#if defined(__AVX512F__)
+  return 1;
+#else
+  return (OPENSSL_get_ia32cap(2) & (1u << 16)) != 0;
+#endif
+}
+
 inline int CRYPTO_is_AVX512BW_capable(void) {
 #if defined(__AVX512BW__)
   return 1;
@@ -1257,6 +1266,14 @@ inline int CRYPTO_is_AVX512BW_capable(void) {
 #endif
 }
 
+inline int CRYPTO_is_AVX512IFMA_capable(void) {
+#if defined(__AVX512IFMA__)
+  return 1;
+#else
+  return (OPENSSL_get_ia32cap(2) & (1u << 21)) != 0;
+#endif
+}
+
 inline int CRYPTO_is_AVX512VL_capable(void) {
 #if defined(__AVX512VL__)
   return 1;
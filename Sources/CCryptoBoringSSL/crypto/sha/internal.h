@@ -0,0 +1,165 @@
+// Copyright 2024 The BoringSSL Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSSL_HEADER_CRYPTO_SHA_INTERNAL_H
+#define OPENSSL_HEADER_CRYPTO_SHA_INTERNAL_H
+
+#include <CCryptoBoringSSL_base.h>
+
+#include "../fipsmodule/sha/internal.h"
+
+#if defined(OPENSSL_SSE2)
+#include <emmintrin.h>
+#define SHA256_X4
+#elif (defined(OPENSSL_ARM) || defined(OPENSSL_AARCH64)) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SHA256_X4
+#endif
+
+// On x86-64, |SHA256_batch| also has eight- and sixteen-lane kernels for AVX2
+// and AVX-512, which are compiled with target attributes and selected at
+// runtime.
+#if !defined(OPENSSL_NO_ASM) && defined(OPENSSL_X86_64) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define SHA256_WIDE
+#endif
+
+
+#if defined(SHA256_X4)
+
+// With SSE2 or NEON, SHA-256 can hash four independent messages at once, one
+// in each 32-bit lane of a vector. The |sha256_vec_*| functions are the vector
+// operations needed for this.
+
+#if defined(OPENSSL_SSE2)
+typedef __m128i sha256_vec_t;
+
+static inline sha256_vec_t sha256_vec_set(uint32_t a, uint32_t b, uint32_t c,
+                                          uint32_t d) {
+  return _mm_set_epi32(d, c, b, a);
+}
+
+static inline void sha256_vec_store(uint32_t out[4], sha256_vec_t v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+}
+
+static inline sha256_vec_t sha256_vec_dup(uint32_t a) {
+  return _mm_set1_epi32(a);
+}
+
+static inline sha256_vec_t sha256_vec_add(sha256_vec_t a, sha256_vec_t b) {
+  return _mm_add_epi32(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_xor(sha256_vec_t a, sha256_vec_t b) {
+  return _mm_xor_si128(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_and(sha256_vec_t a, sha256_vec_t b) {
+  return _mm_and_si128(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_or(sha256_vec_t a, sha256_vec_t b) {
+  return _mm_or_si128(a, b);
+}
+
+// sha256_vec_andnot returns |b| AND NOT |a|.
+static inline sha256_vec_t sha256_vec_andnot(sha256_vec_t a, sha256_vec_t b) {
+  return _mm_andnot_si128(a, b);
+}
+
+template <int kShift>
+static inline sha256_vec_t sha256_vec_shr(sha256_vec_t v) {
+  return _mm_srli_epi32(v, kShift);
+}
+
+template <int kShift>
+static inline sha256_vec_t sha256_vec_rotr(sha256_vec_t v) {
+  return _mm_or_si128(_mm_srli_epi32(v, kShift),
+                      _mm_slli_epi32(v, 32 - kShift));
+}
+#else
+typedef uint32x4_t sha256_vec_t;
+
+static inline sha256_vec_t sha256_vec_set(uint32_t a, uint32_t b, uint32_t c,
+                                          uint32_t d) {
+  const uint32_t words[4] = {a, b, c, d};
+  return vld1q_u32(words);
+}
+
+static inline void sha256_vec_store(uint32_t out[4], sha256_vec_t v) {
+  vst1q_u32(out, v);
+}
+
+static inline sha256_vec_t sha256_vec_dup(uint32_t a) { return vdupq_n_u32(a); }
+
+static inline sha256_vec_t sha256_vec_add(sha256_vec_t a, sha256_vec_t b) {
+  return vaddq_u32(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_xor(sha256_vec_t a, sha256_vec_t b) {
+  return veorq_u32(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_and(sha256_vec_t a, sha256_vec_t b) {
+  return vandq_u32(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_or(sha256_vec_t a, sha256_vec_t b) {
+  return vorrq_u32(a, b);
+}
+
+static inline sha256_vec_t sha256_vec_andnot(sha256_vec_t a, sha256_vec_t b) {
+  return vbicq_u32(b, a);
+}
+
+template <int kShift>
+static inline sha256_vec_t sha256_vec_shr(sha256_vec_t v) {
+  return vshrq_n_u32(v, kShift);
+}
+
+template <int kShift>
+static inline sha256_vec_t sha256_vec_rotr(sha256_vec_t v) {
+  return vsriq_n_u32(vshlq_n_u32(v, 32 - kShift), v, kShift);
+}
+#endif
+
+// sha256_x4_worthwhile returns one if hashing four blocks with
+// |sha256_x4_block| is faster than hashing them one after another. This is not
+// the case when the processor has SHA-256 instructions, which hash a single
+// block more than twice as fast as the four lanes hash four.
+inline int sha256_x4_worthwhile(void) {
+#if defined(SHA256_ASM_HW)
+  return !sha256_hw_capable();
+#else
+  return 1;
+#endif
+}
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// sha256_x4_block runs the SHA-256 compression function on four lanes at once.
+// Word i of each lane's state is in |state[i]| and word i of each lane's
+// message block is in |w[i]|. It updates |state| and overwrites |w|.
+void sha256_x4_block(sha256_vec_t state[8], sha256_vec_t w[16]);
+
+#if defined(__cplusplus)
+}  // extern C
+#endif
+
+#endif  // SHA256_X4
+
+#endif  // OPENSSL_HEADER_CRYPTO_SHA_INTERNAL_H
@@ -17,6 +17,8 @@
 #include <CCryptoBoringSSL_mem.h>
 
 #include "../fipsmodule/bcm_interface.h"
+#include "../internal.h"
+#include "internal.h"
 
 
 int SHA224_Init(SHA256_CTX *sha) {
@@ -85,3 +87,317 @@ void SHA256_TransformBlocks(uint32_t state[8], const uint8_t *data,
                             size_t num_blocks) {
   BCM_sha256_transform_blocks(state, data, num_blocks);
 }
+
+#if defined(SHA256_X4) || defined(SHA256_WIDE)
+
+static const uint32_t kSHA256LanesK[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+// sha256_lanes_tail copies the bytes after the last whole block of each of the
+// |num_lanes| |len|-byte messages in |data| to |tail|, followed by the 0x80
+// terminator and the 64-bit length. It returns the length of each lane's
+// padded tail, which is one or two blocks.
+static size_t sha256_lanes_tail(uint8_t (*tail)[2 * SHA256_CBLOCK],
+                                const uint8_t *const *data, size_t num_lanes,
+                                size_t len) {
+  const size_t done = len - len % SHA256_CBLOCK;
+  const size_t rem = len % SHA256_CBLOCK;
+  const size_t tail_len = rem < SHA256_CBLOCK - 8 ? SHA256_CBLOCK
+                                                  : 2 * SHA256_CBLOCK;
+  OPENSSL_memset(tail, 0, num_lanes * sizeof(tail[0]));
+  for (size_t lane = 0; lane < num_lanes; lane++) {
+    OPENSSL_memcpy(tail[lane], data[lane] + done, rem);
+    tail[lane][rem] = 0x80;
+    CRYPTO_store_u64_be(tail[lane] + tail_len - 8, (uint64_t)len * 8);
+  }
+  return tail_len;
+}
+
+#endif  // SHA256_X4 || SHA256_WIDE
+
+#if defined(SHA256_X4)
+
+void sha256_x4_block(sha256_vec_t state[8], sha256_vec_t w[16]) {
+  sha256_vec_t a = state[0], b = state[1], c = state[2], d = state[3],
+               e = state[4], f = state[5], g = state[6], h = state[7];
+  for (int i = 0; i < 64; i++) {
+    if (i >= 16) {
+      sha256_vec_t w15 = w[(i - 15) & 15], w2 = w[(i - 2) & 15];
+      sha256_vec_t s0 = sha256_vec_xor(
+          sha256_vec_xor(sha256_vec_rotr<7>(w15), sha256_vec_rotr<18>(w15)),
+          sha256_vec_shr<3>(w15));
+      sha256_vec_t s1 = sha256_vec_xor(
+          sha256_vec_xor(sha256_vec_rotr<17>(w2), sha256_vec_rotr<19>(w2)),
+          sha256_vec_shr<10>(w2));
+      w[i & 15] = sha256_vec_add(sha256_vec_add(w[i & 15], s0),
+                                 sha256_vec_add(w[(i - 7) & 15], s1));
+    }
+    sha256_vec_t S1 = sha256_vec_xor(
+        sha256_vec_xor(sha256_vec_rotr<6>(e), sha256_vec_rotr<11>(e)),
+        sha256_vec_rotr<25>(e));
+    sha256_vec_t ch =
+        sha256_vec_xor(sha256_vec_and(e, f), sha256_vec_andnot(e, g));
+    sha256_vec_t t1 = sha256_vec_add(
+        sha256_vec_add(sha256_vec_add(h, S1), ch),
+        sha256_vec_add(sha256_vec_dup(kSHA256LanesK[i]), w[i & 15]));
+    sha256_vec_t S0 = sha256_vec_xor(
+        sha256_vec_xor(sha256_vec_rotr<2>(a), sha256_vec_rotr<13>(a)),
+        sha256_vec_rotr<22>(a));
+    sha256_vec_t maj = sha256_vec_or(sha256_vec_and(a, b),
+                                     sha256_vec_and(c, sha256_vec_or(a, b)));
+    h = g;
+    g = f;
+    f = e;
+    e = sha256_vec_add(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = sha256_vec_add(t1, sha256_vec_add(S0, maj));
+  }
+  state[0] = sha256_vec_add(state[0], a);
+  state[1] = sha256_vec_add(state[1], b);
+  state[2] = sha256_vec_add(state[2], c);
+  state[3] = sha256_vec_add(state[3], d);
+  state[4] = sha256_vec_add(state[4], e);
+  state[5] = sha256_vec_add(state[5], f);
+  state[6] = sha256_vec_add(state[6], g);
+  state[7] = sha256_vec_add(state[7], h);
+}
+
+// sha256_x4_load transposes one block from each of |blocks| into |w|.
+static void sha256_x4_load(sha256_vec_t w[16],
+                           const uint8_t *const blocks[4]) {
+  for (size_t k = 0; k < 16; k++) {
+    w[k] = sha256_vec_set(CRYPTO_load_u32_be(blocks[0] + 4 * k),
+                          CRYPTO_load_u32_be(blocks[1] + 4 * k),
+                          CRYPTO_load_u32_be(blocks[2] + 4 * k),
+                          CRYPTO_load_u32_be(blocks[3] + 4 * k));
+  }
+}
+
+// sha256_x4 writes the SHA-256 digests of the four |len|-byte messages in
+// |data| to |out|, hashing them in one lane each.
+static void sha256_x4(const uint8_t *const data[4], size_t len,
+                      uint8_t *out) {
+  SHA256_CTX ctx;
+  BCM_sha256_init(&ctx);
+  sha256_vec_t state[8], w[16];
+  for (size_t k = 0; k < 8; k++) {
+    state[k] = sha256_vec_dup(ctx.h[k]);
+  }
+
+  const size_t num_blocks = len / SHA256_CBLOCK;
+  for (size_t i = 0; i < num_blocks; i++) {
+    const uint8_t *const blocks[4] = {
+        data[0] + i * SHA256_CBLOCK, data[1] + i * SHA256_CBLOCK,
+        data[2] + i * SHA256_CBLOCK, data[3] + i * SHA256_CBLOCK};
+    sha256_x4_load(w, blocks);
+    sha256_x4_block(state, w);
+  }
+
+  uint8_t tail[4][2 * SHA256_CBLOCK];
+  const size_t tail_len = sha256_lanes_tail(tail, data, 4, len);
+  for (size_t offset = 0; offset < tail_len; offset += SHA256_CBLOCK) {
+    const uint8_t *const blocks[4] = {tail[0] + offset, tail[1] + offset,
+                                      tail[2] + offset, tail[3] + offset};
+    sha256_x4_load(w, blocks);
+    sha256_x4_block(state, w);
+  }
+
+  for (size_t k = 0; k < 8; k++) {
+    uint32_t words[4];
+    sha256_vec_store(words, state[k]);
+    for (size_t lane = 0; lane < 4; lane++) {
+      CRYPTO_store_u32_be(out + lane * SHA256_DIGEST_LENGTH + 4 * k,
+                          words[lane]);
+    }
+  }
+  OPENSSL_cleanse(tail, sizeof(tail));
+  OPENSSL_cleanse(state, sizeof(state));
+  OPENSSL_cleanse(w, sizeof(w));
+}
+
+#endif  // SHA256_X4
+
+#if defined(SHA256_WIDE)
+
+// With AVX2 or AVX-512, the same lane-wise SHA-256 runs on eight or sixteen
+// messages at once. These kernels are written once, with the compiler's
+// generic vector types, and compiled for each instruction set by calling them
+// from a function with the matching target attribute. They must therefore be
+// inlined, and must not call anything that takes or returns a vector.
+
+typedef uint32_t sha256_x8_t __attribute__((vector_size(32)));
+typedef uint32_t sha256_x16_t __attribute__((vector_size(64)));
+
+#define SHA256_WIDE_ROTR(v, n) (((v) >> (n)) | ((v) << (32 - (n))))
+
+// sha256_wide_block runs the SHA-256 compression function on every lane of
+// |Vec|, as |sha256_x4_block| does.
+template <typename Vec>
+static inline __attribute__((always_inline)) void sha256_wide_block(
+    Vec state[8], Vec w[16]) {
+  Vec a = state[0], b = state[1], c = state[2], d = state[3], e = state[4],
+      f = state[5], g = state[6], h = state[7];
+  for (int i = 0; i < 64; i++) {
+    if (i >= 16) {
+      Vec w15 = w[(i - 15) & 15], w2 = w[(i - 2) & 15];
+      Vec s0 = SHA256_WIDE_ROTR(w15, 7) ^ SHA256_WIDE_ROTR(w15, 18) ^
+               (w15 >> 3);
+      Vec s1 = SHA256_WIDE_ROTR(w2, 17) ^ SHA256_WIDE_ROTR(w2, 19) ^
+               (w2 >> 10);
+      w[i & 15] += s0 + w[(i - 7) & 15] + s1;
+    }
+    Vec S1 = SHA256_WIDE_ROTR(e, 6) ^ SHA256_WIDE_ROTR(e, 11) ^
+             SHA256_WIDE_ROTR(e, 25);
+    Vec ch = (e & f) ^ (~e & g);
+    Vec t1 = h + S1 + ch + kSHA256LanesK[i] + w[i & 15];
+    Vec S0 = SHA256_WIDE_ROTR(a, 2) ^ SHA256_WIDE_ROTR(a, 13) ^
+             SHA256_WIDE_ROTR(a, 22);
+    Vec maj = (a & b) | (c & (a | b));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + S0 + maj;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+}
+
+// sha256_wide writes the SHA-256 digests of the |kLanes| |len|-byte messages in
+// |data| to |out|, hashing them in one lane of |Vec| each.
+template <size_t kLanes, typename Vec>
+static inline __attribute__((always_inline)) void sha256_wide(
+    const uint8_t *const data[kLanes], size_t len, uint8_t *out) {
+  SHA256_CTX ctx;
+  BCM_sha256_init(&ctx);
+  Vec state[8], w[16];
+  for (size_t k = 0; k < 8; k++) {
+    for (size_t lane = 0; lane < kLanes; lane++) {
+      state[k][lane] = ctx.h[k];
+    }
+  }
+
+  const size_t num_blocks = len / SHA256_CBLOCK;
+  for (size_t i = 0; i < num_blocks; i++) {
+    for (size_t k = 0; k < 16; k++) {
+      for (size_t lane = 0; lane < kLanes; lane++) {
+        w[k][lane] =
+            CRYPTO_load_u32_be(data[lane] + i * SHA256_CBLOCK + 4 * k);
+      }
+    }
+    sha256_wide_block(state, w);
+  }
+
+  uint8_t tail[kLanes][2 * SHA256_CBLOCK];
+  const size_t tail_len = sha256_lanes_tail(tail, data, kLanes, len);
+  for (size_t offset = 0; offset < tail_len; offset += SHA256_CBLOCK) {
+    for (size_t k = 0; k < 16; k++) {
+      for (size_t lane = 0; lane < kLanes; lane++) {
+        w[k][lane] = CRYPTO_load_u32_be(tail[lane] + offset + 4 * k);
+      }
+    }
+    sha256_wide_block(state, w);
+  }
+
+  for (size_t k = 0; k < 8; k++) {
+    for (size_t lane = 0; lane < kLanes; lane++) {
+      CRYPTO_store_u32_be(out + lane * SHA256_DIGEST_LENGTH + 4 * k,
+                          state[k][lane]);
+    }
+  }
+  OPENSSL_cleanse(tail, sizeof(tail));
+  OPENSSL_cleanse(state, sizeof(state));
+  OPENSSL_cleanse(w, sizeof(w));
+}
+
+#undef SHA256_WIDE_ROTR
+
+// sha256_x8_worthwhile returns one if |sha256_x8| may be used and is faster
+// than both |sha256_x4| and the SHA-256 instructions.
+static int sha256_x8_worthwhile(void) {
+  return CRYPTO_is_AVX2_capable() && !sha256_hw_capable();
+}
+
+__attribute__((target("avx2"))) static void sha256_x8(
+    const uint8_t *const data[8], size_t len, uint8_t *out) {
+  sha256_wide<8, sha256_x8_t>(data, len, out);
+}
+
+// sha256_x16_worthwhile returns one if |sha256_x16| may be used and is faster
+// than the alternatives. On Intel processors it beats even the SHA-256
+// instructions, which hash one block at a time. Elsewhere, such as on AMD
+// processors that split 512-bit operations in two, it is only used without
+// them.
+static int sha256_x16_worthwhile(void) {
+  return CRYPTO_is_AVX512F_capable() && !CRYPTO_cpu_avoid_zmm_registers() &&
+         (!sha256_hw_capable() || CRYPTO_is_intel_cpu());
+}
+
+__attribute__((target("avx512f"))) static void sha256_x16(
+    const uint8_t *const data[16], size_t len, uint8_t *out) {
+  sha256_wide<16, sha256_x16_t>(data, len, out);
+}
+
+#endif  // SHA256_WIDE
+
+void SHA256_batch(const uint8_t *const *data, const size_t *lens, size_t num,
+                  uint8_t *out) {
+#if defined(SHA256_WIDE)
+  const int x16 = sha256_x16_worthwhile(), x8 = sha256_x8_worthwhile();
+#endif
+#if defined(SHA256_X4)
+  const int x4 = sha256_x4_worthwhile();
+#endif
+  size_t i = 0;
+  while (i < num) {
+    // Find the run of messages, up to the widest kernel, with the length of
+    // |data[i]|.
+    size_t run = 1;
+    while (run < 16 && i + run < num && lens[i + run] == lens[i]) {
+      run++;
+    }
+    uint8_t *digests = out + i * SHA256_DIGEST_LENGTH;
+#if defined(SHA256_WIDE)
+    if (run >= 16 && x16) {
+      sha256_x16(data + i, lens[i], digests);
+      i += 16;
+      continue;
+    }
+    if (run >= 8 && x8) {
+      sha256_x8(data + i, lens[i], digests);
+      i += 8;
+      continue;
+    }
+#endif
+#if defined(SHA256_X4)
+    if (run >= 4 && x4) {
+      sha256_x4(data + i, lens[i], digests);
+      i += 4;
+      continue;
+    }
+#endif
+    SHA256(data[i], lens[i], digests);
+    i++;
+  }
+}
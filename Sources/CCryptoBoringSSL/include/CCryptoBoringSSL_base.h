@@ -320,6 +320,8 @@ typedef struct dsa_st DSA;
 typedef struct ec_group_st EC_GROUP;
 typedef struct ec_key_st EC_KEY;
 typedef struct ec_point_st EC_POINT;
+typedef struct ec_point_precomp_st EC_POINT_PRECOMP;
+typedef struct ec_point_table_st EC_POINT_TABLE;
 typedef struct ecdsa_method_st ECDSA_METHOD;
 typedef struct ecdsa_sig_st ECDSA_SIG;
 typedef struct engine_st ENGINE;
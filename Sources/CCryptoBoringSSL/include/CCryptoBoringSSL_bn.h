@@ -271,6 +271,25 @@ OPENSSL_EXPORT BIGNUM *BN_CTX_get(BN_CTX *ctx);
 // matching |BN_CTX_start| call.
 OPENSSL_EXPORT void BN_CTX_end(BN_CTX *ctx);
 
+// BN_CTX_get_thread_local returns a |BN_CTX| owned by the calling thread,
+// creating it on first use, or NULL on allocation failure. It may be passed to
+// any function that takes a |BN_CTX| in place of a new one, which saves
+// allocating temporaries on each call. The caller must not free it and must
+// balance any |BN_CTX_start| calls before returning. It is freed when the thread
+// exits.
+//
+// The |BIGNUM|s of the returned context keep the values of temporaries until
+// they are reused, cleansed with |BN_CTX_cleanse|, or the thread exits. Callers
+// that pass it secret values should call |BN_CTX_cleanse| when done. Once an
+// operation using it has failed, this function returns NULL for the rest of the
+// thread's life.
+OPENSSL_EXPORT BN_CTX *BN_CTX_get_thread_local(void);
+
+// BN_CTX_cleanse erases the values of all |BIGNUM|s in |ctx| that are not
+// currently in use, without freeing them. Calling it when no |BN_CTX_start| is
+// outstanding erases every temporary that earlier operations left in |ctx|.
+OPENSSL_EXPORT void BN_CTX_cleanse(BN_CTX *ctx);
+
 
 // Simple arithmetic
 
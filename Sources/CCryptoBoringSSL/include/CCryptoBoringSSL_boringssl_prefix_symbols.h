@@ -516,9 +516,11 @@
 #define BN_copy BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_copy)
 #define bn_copy_words BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, bn_copy_words)
 #define BN_count_low_zero_bits BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_count_low_zero_bits)
+#define BN_CTX_cleanse BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_cleanse)
 #define BN_CTX_end BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_end)
 #define BN_CTX_free BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_free)
 #define BN_CTX_get BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_get)
+#define BN_CTX_get_thread_local BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_get_thread_local)
 #define BN_CTX_new BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_new)
 #define BN_CTX_start BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_CTX_start)
 #define BN_dec2bn BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_dec2bn)
@@ -585,6 +587,7 @@
 #define BN_mod_exp BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_mod_exp)
 #define BN_mod_exp_mont BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_mod_exp_mont)
 #define BN_mod_exp_mont_consttime BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_mod_exp_mont_consttime)
+#define bn_mod_exp_mont_consttime_x2 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, bn_mod_exp_mont_consttime_x2)
 #define bn_mod_exp_mont_small BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, bn_mod_exp_mont_small)
 #define BN_mod_exp_mont_word BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_mod_exp_mont_word)
 #define BN_mod_exp2_mont BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, BN_mod_exp2_mont)
@@ -943,6 +946,7 @@
 #define CRYPTO_is_AVX_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_AVX_capable)
 #define CRYPTO_is_AVX2_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_AVX2_capable)
 #define CRYPTO_is_AVX512BW_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_AVX512BW_capable)
+#define CRYPTO_is_AVX512IFMA_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_AVX512IFMA_capable)
 #define CRYPTO_is_AVX512VL_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_AVX512VL_capable)
 #define CRYPTO_is_BMI1_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_BMI1_capable)
 #define CRYPTO_is_BMI2_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, CRYPTO_is_BMI2_capable)
@@ -1298,6 +1302,7 @@
 #define ec_init_precomp BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_init_precomp)
 #define ec_jacobian_to_affine BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_jacobian_to_affine)
 #define ec_jacobian_to_affine_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_jacobian_to_affine_batch)
+#define ec_mul_public_pippenger BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_mul_public_pippenger)
 #define EC_KEY_check_fips BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_KEY_check_fips)
 #define EC_KEY_check_key BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_KEY_check_key)
 #define EC_KEY_derive_from_secret BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_KEY_derive_from_secret)
@@ -1353,6 +1358,8 @@
 #define EC_POINT_is_on_curve BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_is_on_curve)
 #define EC_POINT_mul BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_mul)
 #define ec_point_mul_no_self_test BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_mul_no_self_test)
+#define EC_POINT_mul_precomp BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_mul_precomp)
+#define EC_POINT_mul_public_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_mul_public_batch)
 #define ec_point_mul_scalar BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_mul_scalar)
 #define ec_point_mul_scalar_base BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_mul_scalar_base)
 #define ec_point_mul_scalar_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_mul_scalar_batch)
@@ -1364,14 +1371,25 @@
 #define EC_POINT_point2buf BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_point2buf)
 #define EC_POINT_point2cbb BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_point2cbb)
 #define EC_POINT_point2oct BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_point2oct)
+#define EC_POINT_point2oct_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_point2oct_batch)
+#define EC_POINT_PRECOMP_free BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_PRECOMP_free)
+#define EC_POINT_PRECOMP_new BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_PRECOMP_new)
 #define ec_point_select BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_select)
 #define ec_point_set_affine_coordinates BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_set_affine_coordinates)
 #define EC_POINT_set_affine_coordinates BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_set_affine_coordinates)
 #define EC_POINT_set_affine_coordinates_GFp BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_set_affine_coordinates_GFp)
 #define EC_POINT_set_compressed_coordinates_GFp BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_set_compressed_coordinates_GFp)
 #define EC_POINT_set_to_infinity BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_set_to_infinity)
+#define EC_POINT_TABLE_free BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_TABLE_free)
+#define EC_POINT_TABLE_new BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_TABLE_new)
+#define EC_POINT_TABLE_size BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EC_POINT_TABLE_size)
 #define ec_point_to_bytes BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_point_to_bytes)
 #define ec_precomp_select BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_precomp_select)
+#define ec_public_table_cleanup BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_public_table_cleanup)
+#define ec_public_table_init BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_public_table_init)
+#define ec_public_table_mul BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_public_table_mul)
+#define ec_public_table_mul_vartime BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_public_table_mul_vartime)
+#define ec_public_table_size BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_public_table_size)
 #define ec_random_nonzero_scalar BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_random_nonzero_scalar)
 #define ec_random_scalar BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_random_scalar)
 #define ec_scalar_add BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_scalar_add)
@@ -1393,6 +1411,7 @@
 #define ec_simple_scalar_to_montgomery_inv_vartime BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ec_simple_scalar_to_montgomery_inv_vartime)
 #define ECDH_compute_key BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDH_compute_key)
 #define ECDH_compute_key_fips BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDH_compute_key_fips)
+#define ECDH_compute_key_with_table BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDH_compute_key_with_table)
 #define ECDSA_do_sign BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_do_sign)
 #define ECDSA_do_verify BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_do_verify)
 #define ECDSA_SIG_free BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_SIG_free)
@@ -1415,8 +1434,12 @@
 #define ECDSA_size_p1363 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_size_p1363)
 #define ECDSA_verify BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_verify)
 #define ecdsa_verify_fixed BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecdsa_verify_fixed)
+#define ecdsa_verify_fixed_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecdsa_verify_fixed_batch)
 #define ecdsa_verify_fixed_no_self_test BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecdsa_verify_fixed_no_self_test)
+#define ecdsa_verify_fixed_with_table BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecdsa_verify_fixed_with_table)
 #define ECDSA_verify_p1363 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_verify_p1363)
+#define ECDSA_verify_p1363_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_verify_p1363_batch)
+#define ECDSA_verify_p1363_with_table BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ECDSA_verify_p1363_with_table)
 #define ecp_nistz256_div_by_2 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecp_nistz256_div_by_2)
 #define ecp_nistz256_mul_by_2 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecp_nistz256_mul_by_2)
 #define ecp_nistz256_mul_by_3 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, ecp_nistz256_mul_by_3)
@@ -1729,6 +1752,7 @@
 #define EVP_parse_private_key BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_parse_private_key)
 #define EVP_parse_public_key BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_parse_public_key)
 #define EVP_PBE_scrypt BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_PBE_scrypt)
+#define EVP_PBE_scrypt_romix BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_PBE_scrypt_romix)
 #define EVP_PKCS82PKEY BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_PKCS82PKEY)
 #define EVP_PKEY_assign BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_PKEY_assign)
 #define EVP_PKEY_assign_DH BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, EVP_PKEY_assign_DH)
@@ -2390,6 +2414,7 @@
 #define pkcs5_pbe2_nid_to_cipher BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, pkcs5_pbe2_nid_to_cipher)
 #define PKCS5_PBKDF2_HMAC BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, PKCS5_PBKDF2_HMAC)
 #define PKCS5_PBKDF2_HMAC_SHA1 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, PKCS5_PBKDF2_HMAC_SHA1)
+#define PKCS5_PBKDF2_HMAC_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, PKCS5_PBKDF2_HMAC_batch)
 #define pkcs7_add_external_signature BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, pkcs7_add_external_signature)
 #define pkcs7_add_signed_data BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, pkcs7_add_signed_data)
 #define PKCS7_bundle_certificates BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, PKCS7_bundle_certificates)
@@ -2570,6 +2595,10 @@
 #define rsaz_1024_scatter5_avx2 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, rsaz_1024_scatter5_avx2)
 #define rsaz_1024_sqr_avx2 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, rsaz_1024_sqr_avx2)
 #define rsaz_avx2_preferred BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, rsaz_avx2_preferred)
+#define rsaz_ifma_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, rsaz_ifma_capable)
+#define rsaz_ifma_supported_width BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, rsaz_ifma_supported_width)
+#define RSAZ_mod_exp_ifma BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, RSAZ_mod_exp_ifma)
+#define RSAZ_mod_exp_ifma_x2 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, RSAZ_mod_exp_ifma_x2)
 #define s2i_ASN1_INTEGER BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, s2i_ASN1_INTEGER)
 #define s2i_ASN1_OCTET_STRING BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, s2i_ASN1_OCTET_STRING)
 #define SHA1 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA1)
@@ -2592,6 +2621,7 @@
 #define SHA224_Update BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA224_Update)
 #define SHA256 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA256)
 #define sha256_avx_capable BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, sha256_avx_capable)
+#define SHA256_batch BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA256_batch)
 #define sha256_block_data_order_avx BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, sha256_block_data_order_avx)
 #define sha256_block_data_order_hw BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, sha256_block_data_order_hw)
 #define sha256_block_data_order_nohw BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, sha256_block_data_order_nohw)
@@ -2603,6 +2633,8 @@
 #define SHA256_Transform BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA256_Transform)
 #define SHA256_TransformBlocks BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA256_TransformBlocks)
 #define SHA256_Update BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA256_Update)
+#define sha256_x4_block BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, sha256_x4_block)
+#define sha256_x4_worthwhile BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, sha256_x4_worthwhile)
 #define SHA384 BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA384)
 #define SHA384_Final BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA384_Final)
 #define SHA384_Init BORINGSSL_ADD_PREFIX(BORINGSSL_PREFIX, SHA384_Init)
@@ -233,6 +233,19 @@ OPENSSL_EXPORT size_t EC_POINT_point2oct(const EC_GROUP *group,
                                          uint8_t *buf, size_t max_out,
                                          BN_CTX *ctx);
 
+// EC_POINT_point2oct_batch serialises the |num| points in |points| into the
+// X9.62 form given by |form| and writes the concatenated results to |buf|,
+// which must have space for |num| times the length of one point. The
+// conversions to affine coordinates share a single field inversion where the
+// group supports it, so this is cheaper than calling |EC_POINT_point2oct| for
+// each point. |num| must be non-zero and none of the points may be the point
+// at infinity. It returns the number of bytes written or zero on error.
+OPENSSL_EXPORT size_t EC_POINT_point2oct_batch(const EC_GROUP *group,
+                                               const EC_POINT *const *points,
+                                               size_t num,
+                                               point_conversion_form_t form,
+                                               uint8_t *buf, size_t max_out);
+
 // EC_POINT_point2buf serialises |point| into the X9.62 form given by |form| to
 // a newly-allocated buffer and sets |*out_buf| to point to it. It returns the
 // length of the result on success or zero on error. The caller must release
@@ -289,6 +302,69 @@ OPENSSL_EXPORT int EC_POINT_mul(const EC_GROUP *group, EC_POINT *r,
                                 const BIGNUM *n, const EC_POINT *q,
                                 const BIGNUM *m, BN_CTX *ctx);
 
+// EC_POINT_mul_public_batch sets |r| to the sum of |scalars[i]| * |points[i]|
+// for the |num| points in |points|. Each scalar must be non-negative and less
+// than the group order. It returns one on success and zero otherwise.
+//
+// This function runs in time that depends on its inputs and must only be used
+// when the points and scalars are public, such as when verifying a proof.
+OPENSSL_EXPORT int EC_POINT_mul_public_batch(const EC_GROUP *group,
+                                             EC_POINT *r,
+                                             const EC_POINT *const *points,
+                                             const BIGNUM *const *scalars,
+                                             size_t num);
+
+
+// Precomputed points.
+//
+// An |EC_POINT_PRECOMP| holds a table of multiples of a point, which makes
+// multiplying that point by a scalar several times faster on curves that
+// support it. Building the table costs about as much as one multiplication, so
+// it is only worthwhile for points, such as fixed generators and long-lived
+// public keys, that are multiplied many times.
+
+// EC_POINT_PRECOMP_new returns a newly-allocated |EC_POINT_PRECOMP| for |p| on
+// |group|, or NULL on error, including if |p| is the point at infinity.
+OPENSSL_EXPORT EC_POINT_PRECOMP *EC_POINT_PRECOMP_new(const EC_GROUP *group,
+                                                      const EC_POINT *p);
+
+// EC_POINT_PRECOMP_free frees |precomp| and the data that it points to.
+OPENSSL_EXPORT void EC_POINT_PRECOMP_free(EC_POINT_PRECOMP *precomp);
+
+// EC_POINT_mul_precomp sets |r| to |p0| * |m0| + |p1| * |m1|. |p1| and |m1|
+// may be NULL to skip the second term. Each scalar must be non-negative and
+// less than the group order. It returns one on success and zero otherwise.
+//
+// The scalars are treated as secret. However, when both terms are present,
+// this function leaks whether intermediate computations add a point to itself,
+// so the discrete log between |p0| and |p1| must be unknown and the scalars
+// must be uniformly random, as they are for two independent generators.
+OPENSSL_EXPORT int EC_POINT_mul_precomp(const EC_GROUP *group, EC_POINT *r,
+                                        const EC_POINT_PRECOMP *p0,
+                                        const BIGNUM *m0,
+                                        const EC_POINT_PRECOMP *p1,
+                                        const BIGNUM *m1);
+
+// An |EC_POINT_TABLE| holds a larger table of multiples of a point than
+// |EC_POINT_PRECOMP|, built only from generic point operations, so it speeds up
+// every curve, including those without |EC_POINT_PRECOMP| support. Building it
+// costs about three multiplications, after which each multiplication by the
+// point is two to three times faster, so it suits long-lived public keys that
+// are used many times, such as a frequent signer or ECDH peer. See
+// |ECDSA_verify_p1363_with_table| and |ECDH_compute_key_with_table|.
+
+// EC_POINT_TABLE_new returns a newly-allocated |EC_POINT_TABLE| for |p| on
+// |group|, or NULL on error, including if |p| is the point at infinity.
+OPENSSL_EXPORT EC_POINT_TABLE *EC_POINT_TABLE_new(const EC_GROUP *group,
+                                                  const EC_POINT *p);
+
+// EC_POINT_TABLE_free frees |table| and the data that it points to.
+OPENSSL_EXPORT void EC_POINT_TABLE_free(EC_POINT_TABLE *table);
+
+// EC_POINT_TABLE_size returns the number of bytes of memory held by |table|,
+// for callers that bound the memory used by a cache of tables.
+OPENSSL_EXPORT size_t EC_POINT_TABLE_size(const EC_POINT_TABLE *table);
+
 
 // Hash-to-curve.
 //
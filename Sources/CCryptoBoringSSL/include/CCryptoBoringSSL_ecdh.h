@@ -54,6 +54,14 @@ OPENSSL_EXPORT int ECDH_compute_key_fips(uint8_t *out, size_t out_len,
                                          const EC_POINT *pub_key,
                                          const EC_KEY *priv_key);
 
+// ECDH_compute_key_with_table behaves like |ECDH_compute_key| with no |kdf|,
+// but computes the shared key with the peer whose public key's multiples are
+// held in |peer|. Once the table is built, this is two to three times faster,
+// so it suits long-lived peers. |priv_key| is treated as secret.
+OPENSSL_EXPORT int ECDH_compute_key_with_table(void *out, size_t outlen,
+                                               const EC_POINT_TABLE *peer,
+                                               const EC_KEY *priv_key);
+
 
 #if defined(__cplusplus)
 }  // extern C
@@ -176,6 +176,44 @@ OPENSSL_EXPORT int ECDSA_verify_p1363(const uint8_t *digest, size_t digest_len,
                                       const uint8_t *sig, size_t sig_len,
                                       const EC_KEY *key);
 
+// ECDSA_verify_p1363_batch verifies |num| P1363-based signatures. For each i,
+// it sets |out_valid[i]| to one if the |sig_lens[i]| bytes from |sigs[i]| are a
+// valid signature by |keys[i]| of the |digest_lens[i]| bytes from |digests[i]|,
+// and to zero otherwise. Every key must use the same group. It returns one on
+// success, and zero, with every |out_valid[i]| set to zero, if an error
+// occurred.
+//
+// This matches calling |ECDSA_verify_p1363| on each signature, but shares one
+// inversion across the batch. Consecutive signatures whose |keys[i]| are the
+// same pointer also share a table of that key's multiples, so callers should
+// order the batch by key.
+//
+// WARNING: |digests| must be the outputs of some hash function on the data to
+// be verified. Passing unhashed inputs will not result in a secure signature
+// scheme.
+OPENSSL_EXPORT int ECDSA_verify_p1363_batch(uint8_t *out_valid,
+                                            const uint8_t *const *digests,
+                                            const size_t *digest_lens,
+                                            const uint8_t *const *sigs,
+                                            const size_t *sig_lens,
+                                            const EC_KEY *const *keys,
+                                            size_t num);
+
+// ECDSA_verify_p1363_with_table behaves like |ECDSA_verify_p1363|, but
+// verifies against the public key whose multiples are held in |table|. On
+// curves with a specialised implementation, such as P-256, this is about two
+// and a half times faster once the table is built, so it suits keys that sign
+// many of the signatures being verified. On other curves, it is no faster.
+//
+// WARNING: |digest| must be the output of some hash function on the data to be
+// verified. Passing unhashed inputs will not result in a secure signature
+// scheme.
+OPENSSL_EXPORT int ECDSA_verify_p1363_with_table(const uint8_t *digest,
+                                                 size_t digest_len,
+                                                 const uint8_t *sig,
+                                                 size_t sig_len,
+                                                 const EC_POINT_TABLE *table);
+
 // ECDSA_size_p1363 returns the size of a P1363-based ECDSA signature using
 // |key|. It returns zero if |key| is NULL or if it doesn't have a group set.
 OPENSSL_EXPORT size_t ECDSA_size_p1363(const EC_KEY *key);
@@ -445,6 +445,18 @@ OPENSSL_EXPORT int PKCS5_PBKDF2_HMAC_SHA1(const char *password,
                                           uint32_t iterations, size_t key_len,
                                           uint8_t *out_key);
 
+// PKCS5_PBKDF2_HMAC_batch computes |num| keys as |PKCS5_PBKDF2_HMAC| does,
+// where key i is derived from the |password_lens[i]| bytes at |passwords[i]|
+// and the |salt_lens[i]| bytes at |salts[i]|. Each key is |key_len| bytes long
+// and key i is written to |out_keys| + i * |key_len|. With SHA-256, several keys
+// may be computed in parallel in SIMD lanes. It returns one on success and zero
+// on allocation failure or if iterations is 0.
+OPENSSL_EXPORT int PKCS5_PBKDF2_HMAC_batch(
+    const char *const *passwords, const size_t *password_lens,
+    const uint8_t *const *salts, const size_t *salt_lens, size_t num,
+    uint32_t iterations, const EVP_MD *digest, size_t key_len,
+    uint8_t *out_keys);
+
 // EVP_PBE_scrypt expands |password| into a secret key of length |key_len| using
 // scrypt, as described in RFC 7914, and writes the result to |out_key|. It
 // returns one on success and zero on allocation failure, if the memory required
@@ -467,6 +479,20 @@ OPENSSL_EXPORT int EVP_PBE_scrypt(const char *password, size_t password_len,
                                   size_t max_mem, uint8_t *out_key,
                                   size_t key_len);
 
+// EVP_PBE_scrypt_romix applies scrypt's ROMix function, described in RFC 7914
+// section 5, in place to the |128 * r| bytes at |block|. |N| and |r| are as in
+// |EVP_PBE_scrypt|. It returns one on success and zero on allocation failure or
+// if the parameters are invalid.
+//
+// |EVP_PBE_scrypt| derives |p| such blocks from the password and salt with
+// PBKDF2-HMAC-SHA256, applies ROMix to each, and derives the key from the
+// result the same way. The blocks are independent, so callers may use this
+// function to process them on several threads. Each call allocates
+// |128 * r * (N + 2)| bytes, so running |k| at once uses |k| times as much
+// memory as |EVP_PBE_scrypt| does for the blocks' scratch space.
+OPENSSL_EXPORT int EVP_PBE_scrypt_romix(uint8_t *block, uint64_t N,
+                                        uint64_t r);
+
 
 // Public key contexts.
 //
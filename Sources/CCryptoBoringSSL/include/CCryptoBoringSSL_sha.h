@@ -141,6 +141,14 @@ OPENSSL_EXPORT void SHA256_TransformBlocks(uint32_t state[8],
                                            const uint8_t *data,
                                            size_t num_blocks);
 
+// SHA256_batch writes the SHA-256 digests of the |num| messages in |data|, of
+// |lens[i]| bytes each, to |out|, |SHA256_DIGEST_LENGTH| bytes per message.
+// Runs of consecutive messages of equal length are hashed 4, 8 or 16 at a time
+// in vector lanes, where the processor's vector units make that faster than
+// hashing them one at a time.
+OPENSSL_EXPORT void SHA256_batch(const uint8_t *const *data,
+                                 const size_t *lens, size_t num, uint8_t *out);
+
 
 // SHA-384.
 
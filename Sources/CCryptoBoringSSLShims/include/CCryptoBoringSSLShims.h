@@ -75,11 +75,12 @@ void CCryptoBoringSSLShims_ED25519_keypair_from_seed(void *out_public_key,
                                                      void *out_private_key,
                                                      const void *seed);
 
-ECDSA_SIG *CCryptoBoringSSLShims_ECDSA_do_sign(const void *digest, size_t digest_len,
-                                               const EC_KEY *eckey);
+int CCryptoBoringSSLShims_ECDSA_sign_p1363(const void *digest, size_t digest_len, void *sig,
+                                           size_t *out_sig_len, size_t max_sig_len,
+                                           const EC_KEY *eckey);
 
-int CCryptoBoringSSLShims_ECDSA_do_verify(const void *digest, size_t digest_len,
-                                          const ECDSA_SIG *sig, const EC_KEY *eckey);
+int CCryptoBoringSSLShims_ECDSA_verify_p1363(const void *digest, size_t digest_len,
+                                             const void *sig, size_t sig_len, const EC_KEY *eckey);
 
 void CCryptoBoringSSLShims_X25519_keypair(void *out_public_value, void *out_private_key);
 
@@ -148,6 +149,138 @@ size_t CCryptoBoringSSLShims_EC_POINT_point2oct(const EC_GROUP *group,
                                                 void *buf, size_t max_out,
                                                 BN_CTX *ctx);
 
+int CCryptoBoringSSLShims_EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
+                                           ENGINE *engine, const void *key, const void *iv,
+                                           int enc);
+
+int CCryptoBoringSSLShims_EVP_CipherUpdate(EVP_CIPHER_CTX *ctx, void *out, int *out_len,
+                                          const void *in, int in_len);
+
+int CCryptoBoringSSLShims_EVP_CipherFinal_ex(EVP_CIPHER_CTX *ctx, void *out, int *out_len);
+
+void CCryptoBoringSSLShims_CRYPTO_chacha_20(void *out, const void *in, size_t in_len,
+                                            const void *key, const void *nonce,
+                                            uint32_t counter);
+
+void CCryptoBoringSSLShims_CRYPTO_poly1305_init(void *state, const void *key);
+
+void CCryptoBoringSSLShims_CRYPTO_poly1305_update(void *state, const void *in, size_t in_len);
+
+void CCryptoBoringSSLShims_CRYPTO_poly1305_finish(void *state, void *mac);
+
+// Pushes the error that |EVP_AEAD_CTX_open| reports when a tag doesn't authenticate a message, for AEADs that are
+// implemented outside of |EVP_AEAD| to report the same failure.
+void CCryptoBoringSSLShims_ERR_put_bad_decrypt(void);
+
+// Writes the SHA-256 digest of each of the |count| messages to |out|, |SHA256_DIGEST_LENGTH| bytes apiece, with
+// |SHA256_batch|.
+void CCryptoBoringSSLShims_SHA256_batch(const void *const *messages, const size_t *message_lens,
+                                        size_t count, void *out);
+
+// Verifies each of the |count| P1363 ECDSA signatures with |ECDSA_verify_p1363_batch|, setting |out_valid[i]| to one
+// if |signatures[i]| is a valid signature by |keys[i]| of |digests[i]| and zero otherwise.
+int CCryptoBoringSSLShims_ECDSA_verify_p1363_batch(uint8_t *out_valid, const void *const *digests,
+                                                   const size_t *digest_lens, const void *const *signatures,
+                                                   const size_t *signature_lens, const EC_KEY *const *keys,
+                                                   size_t count);
+
+int CCryptoBoringSSLShims_ECDSA_verify_p1363_with_table(const void *digest, size_t digest_len, const void *sig,
+                                                        size_t sig_len, const EC_POINT_TABLE *table);
+
+// The state of BoringSSL's Keccak core, which backs SHA-3 and SHAKE.
+//
+// The core is exported for BoringSSL's ML-KEM and ML-DSA implementations, but it is only declared in an internal
+// header. This mirrors |struct BORINGSSL_keccak_st| from crypto/fipsmodule/keccak/internal.h so that Swift can store
+// it, and must be kept in sync with that header when BoringSSL is updated.
+typedef struct {
+    uint64_t state[25];
+    int32_t config;
+    int32_t phase;
+    size_t required_out_len;
+    size_t rate_bytes;
+    size_t absorb_offset;
+    size_t squeeze_offset;
+} CCryptoBoringSSLShims_keccak_st;
+
+typedef enum {
+    CCryptoBoringSSLShims_keccak_sha3_256,
+    CCryptoBoringSSLShims_keccak_sha3_384,
+    CCryptoBoringSSLShims_keccak_sha3_512,
+    CCryptoBoringSSLShims_keccak_shake128,
+    CCryptoBoringSSLShims_keccak_shake256,
+} CCryptoBoringSSLShims_keccak_variant;
+
+// Prepares |ctx| for absorbing. The SHA-3 variants must be squeezed in a single call for exactly their digest length.
+void CCryptoBoringSSLShims_keccak_init(CCryptoBoringSSLShims_keccak_st *ctx,
+                                       CCryptoBoringSSLShims_keccak_variant variant);
+
+void CCryptoBoringSSLShims_keccak_absorb(CCryptoBoringSSLShims_keccak_st *ctx, const void *in, size_t in_len);
+
+void CCryptoBoringSSLShims_keccak_squeeze(CCryptoBoringSSLShims_keccak_st *ctx, void *out, size_t out_len);
+
+// An integer modulo the order of an elliptic curve group, held in Montgomery form.
+//
+// This mirrors |EC_SCALAR| from crypto/fipsmodule/ec/internal.h, which is sized for the largest supported group,
+// P-521, so that Swift can store scalars inline rather than as heap-allocated BIGNUMs. It must be kept in sync with
+// that header when BoringSSL is updated.
+typedef struct {
+    BN_ULONG words[(66 * 8 + BN_BITS2 - 1) / BN_BITS2];
+} CCryptoBoringSSLShims_ec_scalar;
+
+// Sets |out| to the big-endian integer in |in| reduced modulo the order of |group|. It returns one on success and
+// zero if |in| is too long for the integer to be guaranteed less than the square of the order.
+int CCryptoBoringSSLShims_ec_scalar_from_bytes(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *out,
+                                               const void *in, size_t in_len);
+
+// Writes |in| to |out| as a big-endian integer the length of the order of |group|, and sets |*out_len| to that length.
+void CCryptoBoringSSLShims_ec_scalar_to_bytes(const EC_GROUP *group, void *out, size_t *out_len,
+                                              const CCryptoBoringSSLShims_ec_scalar *in);
+
+// Sets |out| to a uniformly random scalar. It returns one on success and zero on error.
+int CCryptoBoringSSLShims_ec_scalar_random(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *out);
+
+void CCryptoBoringSSLShims_ec_scalar_add(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a,
+                                         const CCryptoBoringSSLShims_ec_scalar *b);
+
+void CCryptoBoringSSLShims_ec_scalar_sub(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a,
+                                         const CCryptoBoringSSLShims_ec_scalar *b);
+
+void CCryptoBoringSSLShims_ec_scalar_neg(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a);
+
+void CCryptoBoringSSLShims_ec_scalar_mul(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a,
+                                         const CCryptoBoringSSLShims_ec_scalar *b);
+
+// Sets |r| to the inverse of |a|, or to zero if |a| is zero.
+void CCryptoBoringSSLShims_ec_scalar_inv0(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                          const CCryptoBoringSSLShims_ec_scalar *a);
+
+int CCryptoBoringSSLShims_ec_scalar_is_zero(const EC_GROUP *group, const CCryptoBoringSSLShims_ec_scalar *a);
+
+// Returns one if |a| and |b| are equal and zero otherwise, in constant time.
+int CCryptoBoringSSLShims_ec_scalar_equal(const EC_GROUP *group, const CCryptoBoringSSLShims_ec_scalar *a,
+                                          const CCryptoBoringSSLShims_ec_scalar *b);
+
+// Sets |r| to |scalar| times |p|. It returns one on success and zero on error.
+int CCryptoBoringSSLShims_EC_POINT_mul_ec_scalar(const EC_GROUP *group, EC_POINT *r, const EC_POINT *p,
+                                                 const CCryptoBoringSSLShims_ec_scalar *scalar);
+
+// Sets |r| to |scalar| times the point that |p| was computed from, with |EC_POINT_mul_precomp|. It returns one on
+// success and zero on error.
+int CCryptoBoringSSLShims_EC_POINT_mul_precomp_ec_scalar(const EC_GROUP *group, EC_POINT *r,
+                                                         const EC_POINT_PRECOMP *p,
+                                                         const CCryptoBoringSSLShims_ec_scalar *scalar);
+
+// Sets |r| to the sum of |scalars[i]| times |points[i]| for the |num| terms, with |EC_POINT_mul_public_batch|. It
+// returns one on success and zero on error. As with that function, the inputs must be public.
+int CCryptoBoringSSLShims_EC_POINT_mul_public_batch_ec_scalars(const EC_GROUP *group, EC_POINT *r,
+                                                               const EC_POINT *const *points,
+                                                               const CCryptoBoringSSLShims_ec_scalar *scalars,
+                                                               size_t num);
+
 #if defined(__cplusplus)
 }
 #endif // defined(__cplusplus)
@@ -72,14 +72,15 @@ void CCryptoBoringSSLShims_ED25519_keypair_from_seed(void *out_public_key,
     CCryptoBoringSSL_ED25519_keypair_from_seed(out_public_key, out_private_key, seed);
 }
 
-ECDSA_SIG *CCryptoBoringSSLShims_ECDSA_do_sign(const void *digest, size_t digest_len,
-                                               const EC_KEY *eckey) {
-    return CCryptoBoringSSL_ECDSA_do_sign(digest, digest_len, eckey);
+int CCryptoBoringSSLShims_ECDSA_sign_p1363(const void *digest, size_t digest_len, void *sig,
+                                           size_t *out_sig_len, size_t max_sig_len,
+                                           const EC_KEY *eckey) {
+    return CCryptoBoringSSL_ECDSA_sign_p1363(digest, digest_len, sig, out_sig_len, max_sig_len, eckey);
 }
 
-int CCryptoBoringSSLShims_ECDSA_do_verify(const void *digest, size_t digest_len,
-                                          const ECDSA_SIG *sig, const EC_KEY *eckey) {
-    return CCryptoBoringSSL_ECDSA_do_verify(digest, digest_len, sig, eckey);
+int CCryptoBoringSSLShims_ECDSA_verify_p1363(const void *digest, size_t digest_len,
+                                             const void *sig, size_t sig_len, const EC_KEY *eckey) {
+    return CCryptoBoringSSL_ECDSA_verify_p1363(digest, digest_len, sig, sig_len, eckey);
 }
 
 void CCryptoBoringSSLShims_X25519_keypair(void *out_public_value, void *out_private_key) {
@@ -188,3 +189,266 @@ size_t CCryptoBoringSSLShims_EC_POINT_point2oct(const EC_GROUP *group,
                                                 BN_CTX *ctx) {
     return CCryptoBoringSSL_EC_POINT_point2oct(group, point, form, buf, max_out, ctx);
 }
+
+int CCryptoBoringSSLShims_EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
+                                           ENGINE *engine, const void *key, const void *iv,
+                                           int enc) {
+    return CCryptoBoringSSL_EVP_CipherInit_ex(ctx, cipher, engine, key, iv, enc);
+}
+
+int CCryptoBoringSSLShims_EVP_CipherUpdate(EVP_CIPHER_CTX *ctx, void *out, int *out_len,
+                                          const void *in, int in_len) {
+    return CCryptoBoringSSL_EVP_CipherUpdate(ctx, out, out_len, in, in_len);
+}
+
+int CCryptoBoringSSLShims_EVP_CipherFinal_ex(EVP_CIPHER_CTX *ctx, void *out, int *out_len) {
+    return CCryptoBoringSSL_EVP_CipherFinal_ex(ctx, out, out_len);
+}
+
+void CCryptoBoringSSLShims_CRYPTO_chacha_20(void *out, const void *in, size_t in_len,
+                                            const void *key, const void *nonce,
+                                            uint32_t counter) {
+    CCryptoBoringSSL_CRYPTO_chacha_20(out, in, in_len, key, nonce, counter);
+}
+
+void CCryptoBoringSSLShims_CRYPTO_poly1305_init(void *state, const void *key) {
+    CCryptoBoringSSL_CRYPTO_poly1305_init(state, key);
+}
+
+void CCryptoBoringSSLShims_CRYPTO_poly1305_update(void *state, const void *in, size_t in_len) {
+    CCryptoBoringSSL_CRYPTO_poly1305_update(state, in, in_len);
+}
+
+void CCryptoBoringSSLShims_CRYPTO_poly1305_finish(void *state, void *mac) {
+    CCryptoBoringSSL_CRYPTO_poly1305_finish(state, mac);
+}
+
+void CCryptoBoringSSLShims_ERR_put_bad_decrypt(void) {
+    OPENSSL_PUT_ERROR(CIPHER, CIPHER_R_BAD_DECRYPT);
+}
+
+void CCryptoBoringSSLShims_SHA256_batch(const void *const *messages, const size_t *message_lens,
+                                        size_t count, void *out) {
+    CCryptoBoringSSL_SHA256_batch((const uint8_t *const *)messages, message_lens, count, out);
+}
+
+int CCryptoBoringSSLShims_ECDSA_verify_p1363_batch(uint8_t *out_valid, const void *const *digests,
+                                                   const size_t *digest_lens, const void *const *signatures,
+                                                   const size_t *signature_lens, const EC_KEY *const *keys,
+                                                   size_t count) {
+    return CCryptoBoringSSL_ECDSA_verify_p1363_batch(out_valid, (const uint8_t *const *)digests, digest_lens,
+                                                     (const uint8_t *const *)signatures, signature_lens, keys,
+                                                     count);
+}
+
+int CCryptoBoringSSLShims_ECDSA_verify_p1363_with_table(const void *digest, size_t digest_len, const void *sig,
+                                                        size_t sig_len, const EC_POINT_TABLE *table) {
+    return CCryptoBoringSSL_ECDSA_verify_p1363_with_table(digest, digest_len, sig, sig_len, table);
+}
+
+// These are exported from BoringSSL but declared only in its internal Keccak header, so we declare them here. The
+// prefixing macros from |CCryptoBoringSSL_boringssl_prefix_symbols.h| give them their CCryptoBoringSSL_ names.
+struct BORINGSSL_keccak_st;
+void BORINGSSL_keccak_init(struct BORINGSSL_keccak_st *ctx, int32_t config);
+void BORINGSSL_keccak_absorb(struct BORINGSSL_keccak_st *ctx, const uint8_t *in, size_t in_len);
+void BORINGSSL_keccak_squeeze(struct BORINGSSL_keccak_st *ctx, uint8_t *out, size_t out_len);
+
+// The values of |enum boringssl_keccak_config_t|.
+enum {
+    CCryptoBoringSSLShims_boringssl_sha3_256 = 0,
+    CCryptoBoringSSLShims_boringssl_sha3_512 = 1,
+    CCryptoBoringSSLShims_boringssl_shake128 = 2,
+    CCryptoBoringSSLShims_boringssl_shake256 = 3,
+    CCryptoBoringSSLShims_boringssl_sha3_384 = 4,
+};
+
+void CCryptoBoringSSLShims_keccak_init(CCryptoBoringSSLShims_keccak_st *ctx,
+                                       CCryptoBoringSSLShims_keccak_variant variant) {
+    struct BORINGSSL_keccak_st *keccak = (struct BORINGSSL_keccak_st *)ctx;
+    switch (variant) {
+        case CCryptoBoringSSLShims_keccak_sha3_256:
+            BORINGSSL_keccak_init(keccak, CCryptoBoringSSLShims_boringssl_sha3_256);
+            break;
+        case CCryptoBoringSSLShims_keccak_sha3_384:
+            BORINGSSL_keccak_init(keccak, CCryptoBoringSSLShims_boringssl_sha3_384);
+            break;
+        case CCryptoBoringSSLShims_keccak_sha3_512:
+            BORINGSSL_keccak_init(keccak, CCryptoBoringSSLShims_boringssl_sha3_512);
+            break;
+        case CCryptoBoringSSLShims_keccak_shake128:
+            BORINGSSL_keccak_init(keccak, CCryptoBoringSSLShims_boringssl_shake128);
+            break;
+        case CCryptoBoringSSLShims_keccak_shake256:
+            BORINGSSL_keccak_init(keccak, CCryptoBoringSSLShims_boringssl_shake256);
+            break;
+        default:
+            abort();
+    }
+}
+
+void CCryptoBoringSSLShims_keccak_absorb(CCryptoBoringSSLShims_keccak_st *ctx, const void *in, size_t in_len) {
+    BORINGSSL_keccak_absorb((struct BORINGSSL_keccak_st *)ctx, in, in_len);
+}
+
+void CCryptoBoringSSLShims_keccak_squeeze(CCryptoBoringSSLShims_keccak_st *ctx, void *out, size_t out_len) {
+    BORINGSSL_keccak_squeeze((struct BORINGSSL_keccak_st *)ctx, out, out_len);
+}
+
+// These are exported from BoringSSL but declared only in its internal EC header, so we declare them here in terms of
+// our mirror of |EC_SCALAR|. As above, the prefixing macros give them their CCryptoBoringSSL_ names.
+void ec_scalar_reduce(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *out, const BN_ULONG *words, size_t num);
+void ec_scalar_to_bytes(const EC_GROUP *group, uint8_t *out, size_t *out_len,
+                        const CCryptoBoringSSLShims_ec_scalar *in);
+int ec_random_scalar(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *out, const uint8_t additional_data[32]);
+int ec_scalar_is_zero(const EC_GROUP *group, const CCryptoBoringSSLShims_ec_scalar *a);
+void ec_scalar_add(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r, const CCryptoBoringSSLShims_ec_scalar *a,
+                   const CCryptoBoringSSLShims_ec_scalar *b);
+void ec_scalar_sub(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r, const CCryptoBoringSSLShims_ec_scalar *a,
+                   const CCryptoBoringSSLShims_ec_scalar *b);
+void ec_scalar_neg(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r, const CCryptoBoringSSLShims_ec_scalar *a);
+void ec_scalar_to_montgomery(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                             const CCryptoBoringSSLShims_ec_scalar *a);
+void ec_scalar_from_montgomery(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                               const CCryptoBoringSSLShims_ec_scalar *a);
+void ec_scalar_mul_montgomery(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                              const CCryptoBoringSSLShims_ec_scalar *a, const CCryptoBoringSSLShims_ec_scalar *b);
+void ec_scalar_inv0_montgomery(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                               const CCryptoBoringSSLShims_ec_scalar *a);
+
+#define CCryptoBoringSSLShims_ec_scalar_max_words (sizeof(((CCryptoBoringSSLShims_ec_scalar *)NULL)->words) / sizeof(BN_ULONG))
+
+int CCryptoBoringSSLShims_ec_scalar_from_bytes(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *out,
+                                               const void *in, size_t in_len) {
+    // |ec_scalar_reduce| needs its input to be less than the square of the order, which this length bound ensures.
+    const size_t order_bits = CCryptoBoringSSL_BN_num_bits(CCryptoBoringSSL_EC_GROUP_get0_order(group));
+    if (in_len * 8 > 2 * (order_bits - 1)) {
+        return 0;
+    }
+
+    const size_t order_words = (order_bits + BN_BITS2 - 1) / BN_BITS2;
+    BN_ULONG words[2 * CCryptoBoringSSLShims_ec_scalar_max_words] = {0};
+    const uint8_t *bytes = in;
+    for (size_t i = 0; i < in_len; i++) {
+        const size_t bit = 8 * (in_len - 1 - i);
+        words[bit / BN_BITS2] |= (BN_ULONG)bytes[i] << (bit % BN_BITS2);
+    }
+
+    // This leaves |out| in the normal domain, so convert it into the Montgomery one.
+    ec_scalar_reduce(group, out, words, 2 * order_words);
+    ec_scalar_to_montgomery(group, out, out);
+    CCryptoBoringSSL_OPENSSL_cleanse(words, sizeof(words));
+    return 1;
+}
+
+void CCryptoBoringSSLShims_ec_scalar_to_bytes(const EC_GROUP *group, void *out, size_t *out_len,
+                                              const CCryptoBoringSSLShims_ec_scalar *in) {
+    CCryptoBoringSSLShims_ec_scalar normal;
+    ec_scalar_from_montgomery(group, &normal, in);
+    ec_scalar_to_bytes(group, out, out_len, &normal);
+    CCryptoBoringSSL_OPENSSL_cleanse(&normal, sizeof(normal));
+}
+
+int CCryptoBoringSSLShims_ec_scalar_random(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *out) {
+    // A uniformly random scalar is also uniformly random in the Montgomery domain, so it needs no conversion.
+    static const uint8_t additional_data[32] = {0};
+    return ec_random_scalar(group, out, additional_data);
+}
+
+void CCryptoBoringSSLShims_ec_scalar_add(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a,
+                                         const CCryptoBoringSSLShims_ec_scalar *b) {
+    ec_scalar_add(group, r, a, b);
+}
+
+void CCryptoBoringSSLShims_ec_scalar_sub(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a,
+                                         const CCryptoBoringSSLShims_ec_scalar *b) {
+    ec_scalar_sub(group, r, a, b);
+}
+
+void CCryptoBoringSSLShims_ec_scalar_neg(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a) {
+    ec_scalar_neg(group, r, a);
+}
+
+void CCryptoBoringSSLShims_ec_scalar_mul(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                         const CCryptoBoringSSLShims_ec_scalar *a,
+                                         const CCryptoBoringSSLShims_ec_scalar *b) {
+    ec_scalar_mul_montgomery(group, r, a, b);
+}
+
+void CCryptoBoringSSLShims_ec_scalar_inv0(const EC_GROUP *group, CCryptoBoringSSLShims_ec_scalar *r,
+                                          const CCryptoBoringSSLShims_ec_scalar *a) {
+    ec_scalar_inv0_montgomery(group, r, a);
+}
+
+int CCryptoBoringSSLShims_ec_scalar_is_zero(const EC_GROUP *group, const CCryptoBoringSSLShims_ec_scalar *a) {
+    return ec_scalar_is_zero(group, a);
+}
+
+int CCryptoBoringSSLShims_ec_scalar_equal(const EC_GROUP *group, const CCryptoBoringSSLShims_ec_scalar *a,
+                                          const CCryptoBoringSSLShims_ec_scalar *b) {
+    // Only the words that the order spans are meaningful.
+    const size_t order_bits = CCryptoBoringSSL_BN_num_bits(CCryptoBoringSSL_EC_GROUP_get0_order(group));
+    const size_t order_words = (order_bits + BN_BITS2 - 1) / BN_BITS2;
+    return CCryptoBoringSSL_CRYPTO_memcmp(a->words, b->words, order_words * sizeof(BN_ULONG)) == 0;
+}
+
+// Points |out| at |storage|, which it sets to |in| out of the Montgomery domain, so that the point functions can
+// take a scalar without a heap-allocated BIGNUM. |out| must not outlive |storage|, which the caller must cleanse.
+static void CCryptoBoringSSLShims_ec_scalar_to_static_bignum(const EC_GROUP *group, BIGNUM *out,
+                                                             CCryptoBoringSSLShims_ec_scalar *storage,
+                                                             const CCryptoBoringSSLShims_ec_scalar *in) {
+    const size_t order_bits = CCryptoBoringSSL_BN_num_bits(CCryptoBoringSSL_EC_GROUP_get0_order(group));
+    ec_scalar_from_montgomery(group, storage, in);
+    out->d = storage->words;
+    out->width = (int)((order_bits + BN_BITS2 - 1) / BN_BITS2);
+    out->dmax = out->width;
+    out->neg = 0;
+    out->flags = BN_FLG_STATIC_DATA;
+}
+
+int CCryptoBoringSSLShims_EC_POINT_mul_ec_scalar(const EC_GROUP *group, EC_POINT *r, const EC_POINT *p,
+                                                 const CCryptoBoringSSLShims_ec_scalar *scalar) {
+    CCryptoBoringSSLShims_ec_scalar storage;
+    BIGNUM bn;
+    CCryptoBoringSSLShims_ec_scalar_to_static_bignum(group, &bn, &storage, scalar);
+    // Our scalars are always reduced, so this needs no BN_CTX.
+    int ret = CCryptoBoringSSL_EC_POINT_mul(group, r, NULL, p, &bn, NULL);
+    CCryptoBoringSSL_OPENSSL_cleanse(&storage, sizeof(storage));
+    return ret;
+}
+
+int CCryptoBoringSSLShims_EC_POINT_mul_precomp_ec_scalar(const EC_GROUP *group, EC_POINT *r,
+                                                         const EC_POINT_PRECOMP *p,
+                                                         const CCryptoBoringSSLShims_ec_scalar *scalar) {
+    CCryptoBoringSSLShims_ec_scalar storage;
+    BIGNUM bn;
+    CCryptoBoringSSLShims_ec_scalar_to_static_bignum(group, &bn, &storage, scalar);
+    int ret = CCryptoBoringSSL_EC_POINT_mul_precomp(group, r, p, &bn, NULL, NULL);
+    CCryptoBoringSSL_OPENSSL_cleanse(&storage, sizeof(storage));
+    return ret;
+}
+
+int CCryptoBoringSSLShims_EC_POINT_mul_public_batch_ec_scalars(const EC_GROUP *group, EC_POINT *r,
+                                                               const EC_POINT *const *points,
+                                                               const CCryptoBoringSSLShims_ec_scalar *scalars,
+                                                               size_t num) {
+    // One allocation holds every term's converted scalar, its BIGNUM and the pointer to that BIGNUM.
+    const size_t term_size = sizeof(CCryptoBoringSSLShims_ec_scalar) + sizeof(BIGNUM) + sizeof(BIGNUM *);
+    uint8_t *terms = CCryptoBoringSSL_OPENSSL_calloc(num == 0 ? 1 : num, term_size);
+    if (terms == NULL) {
+        return 0;
+    }
+    CCryptoBoringSSLShims_ec_scalar *storage = (CCryptoBoringSSLShims_ec_scalar *)terms;
+    BIGNUM *bns = (BIGNUM *)(storage + num);
+    const BIGNUM **bn_pointers = (const BIGNUM **)(bns + num);
+    for (size_t i = 0; i < num; i++) {
+        CCryptoBoringSSLShims_ec_scalar_to_static_bignum(group, &bns[i], &storage[i], &scalars[i]);
+        bn_pointers[i] = &bns[i];
+    }
+
+    int ret = CCryptoBoringSSL_EC_POINT_mul_public_batch(group, r, points, bn_pointers, num);
+    CCryptoBoringSSL_OPENSSL_free(terms);
+    return ret;
+}
@@ -29,7 +29,12 @@ extension BoringSSLAEAD {
         authenticatedData: AuthenticatedData
     ) throws -> (ciphertext: Data, tag: Data) {
         do {
-            let context = try AEADContext(cipher: self, key: key)
+            // Only set up for processing discontiguous input when there is some, as that costs extra work per key.
+            let context = try AEADContext(
+                cipher: self,
+                key: key,
+                preparingForDiscontiguousInput: message.regions.count != 1 || authenticatedData.regions.count != 1
+            )
             return try context.seal(
                 message: message,
                 nonce: nonce,
@@ -37,6 +42,8 @@ extension BoringSSLAEAD {
             )
         } catch CryptoBoringWrapperError.underlyingCoreCryptoError(let errorCode) {
             throw CryptoKitError.underlyingCoreCryptoError(error: errorCode)
+        } catch CryptoBoringWrapperError.incorrectParameterSize {
+            throw CryptoKitError.incorrectParameterSize
         }
     }
 
@@ -49,7 +56,11 @@ extension BoringSSLAEAD {
         authenticatedData: AuthenticatedData
     ) throws -> Data {
         do {
-            let context = try AEADContext(cipher: self, key: key)
+            let context = try AEADContext(
+                cipher: self,
+                key: key,
+                preparingForDiscontiguousInput: authenticatedData.regions.count != 1
+            )
             return try context.open(
                 ciphertext: ciphertext,
                 nonce: nonce,
@@ -58,6 +69,8 @@ extension BoringSSLAEAD {
             )
         } catch CryptoBoringWrapperError.underlyingCoreCryptoError(let errorCode) {
             throw CryptoKitError.underlyingCoreCryptoError(error: errorCode)
+        } catch CryptoBoringWrapperError.incorrectParameterSize {
+            throw CryptoKitError.incorrectParameterSize
         }
     }
 }
@@ -36,26 +36,20 @@ extension OpenSSLSupportedNISTCurve {
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension P256: OpenSSLSupportedNISTCurve {
-    @inlinable
-    static var group: BoringSSLEllipticCurveGroup {
-        try! BoringSSLEllipticCurveGroup(.p256)
-    }
+    @usableFromInline
+    static let group: BoringSSLEllipticCurveGroup = try! BoringSSLEllipticCurveGroup(.p256)
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension P384: OpenSSLSupportedNISTCurve {
-    @inlinable
-    static var group: BoringSSLEllipticCurveGroup {
-        try! BoringSSLEllipticCurveGroup(.p384)
-    }
+    @usableFromInline
+    static let group: BoringSSLEllipticCurveGroup = try! BoringSSLEllipticCurveGroup(.p384)
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension P521: OpenSSLSupportedNISTCurve {
-    @inlinable
-    static var group: BoringSSLEllipticCurveGroup {
-        try! BoringSSLEllipticCurveGroup(.p521)
-    }
+    @usableFromInline
+    static let group: BoringSSLEllipticCurveGroup = try! BoringSSLEllipticCurveGroup(.p521)
 }
 
 @usableFromInline
@@ -325,16 +319,31 @@ class BoringSSLECPrivateKeyWrapper<Curve: OpenSSLSupportedNISTCurve> {
         }
     }
 
-    func sign<D: Digest>(digest: D) throws -> ECDSASignature {
-        let optionalRawSignature: UnsafeMutablePointer<ECDSA_SIG>? = digest.withUnsafeBytes {
-            digestPtr in
-            CCryptoBoringSSLShims_ECDSA_do_sign(digestPtr.baseAddress, digestPtr.count, self.key)
+    /// Signs `digest`, returning the raw `r || s` signature as defined in IEEE P1363.
+    ///
+    /// BoringSSL writes this form straight into the output, so signing needs no `ECDSA_SIG` or bignums.
+    func rawSignature<D: Digest>(digest: D) throws -> Data {
+        let signatureByteCount = CCryptoBoringSSL_ECDSA_size_p1363(self.key)
+        var signature = Data(count: signatureByteCount)
+        let rc: CInt = signature.withUnsafeMutableBytes { signaturePtr in
+            digest.withUnsafeBytes { digestPtr in
+                var signatureLength = 0
+                let rc = CCryptoBoringSSLShims_ECDSA_sign_p1363(
+                    digestPtr.baseAddress,
+                    digestPtr.count,
+                    signaturePtr.baseAddress,
+                    &signatureLength,
+                    signaturePtr.count,
+                    self.key
+                )
+                return signatureLength == signatureByteCount ? rc : 0
+            }
         }
-        guard let rawSignature = optionalRawSignature else {
+        guard rc == 1 else {
             throw CryptoKitError.internalBoringSSLError()
         }
 
-        return ECDSASignature(takingOwnershipOf: rawSignature)
+        return signature
     }
 
     deinit {
@@ -565,13 +574,15 @@ class BoringSSLECPublicKeyWrapper<Curve: OpenSSLSupportedNISTCurve> {
         }
     }
 
-    func isValidSignature<D: Digest>(_ signature: ECDSASignature, for digest: D) -> Bool {
-        let rc: CInt = signature.withUnsafeSignaturePointer { signaturePointer in
+    /// Verifies a raw `r || s` signature as defined in IEEE P1363, without decoding it into an `ECDSA_SIG`.
+    func isValidRawSignature<D: Digest>(_ signature: Data, for digest: D) -> Bool {
+        let rc: CInt = signature.withUnsafeBytes { signaturePointer in
             digest.withUnsafeBytes { digestPointer in
-                CCryptoBoringSSLShims_ECDSA_do_verify(
+                CCryptoBoringSSLShims_ECDSA_verify_p1363(
                     digestPointer.baseAddress,
                     digestPointer.count,
-                    signaturePointer,
+                    signaturePointer.baseAddress,
+                    signaturePointer.count,
                     self.key
                 )
             }
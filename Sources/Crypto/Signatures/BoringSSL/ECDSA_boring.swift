@@ -73,8 +73,7 @@ extension P256.Signing.ECDSASignature {
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension P256.Signing.PrivateKey {
     func openSSLSignature<D: Digest>(for digest: D) throws -> P256.Signing.ECDSASignature {
-        let baseSignature = try self.impl.key.sign(digest: digest)
-        return try .init(rawRepresentation: Data(rawSignature: baseSignature, over: P256.self))
+        try .init(self.impl.key.rawSignature(digest: digest))
     }
 }
 
@@ -86,13 +85,7 @@ extension P256.Signing.PublicKey {
     )
         -> Bool
     {
-        guard let baseSignature = try? ECDSASignature(rawRepresentation: signature.rawRepresentation)
-        else {
-            // If we can't create a signature, it's not valid.
-            return false
-        }
-
-        return self.impl.key.isValidSignature(baseSignature, for: digest)
+        self.impl.key.isValidRawSignature(signature.rawRepresentation, for: digest)
     }
 }
 
@@ -110,8 +103,7 @@ extension P384.Signing.ECDSASignature {
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension P384.Signing.PrivateKey {
     func openSSLSignature<D: Digest>(for digest: D) throws -> P384.Signing.ECDSASignature {
-        let baseSignature = try self.impl.key.sign(digest: digest)
-        return try .init(rawRepresentation: Data(rawSignature: baseSignature, over: P384.self))
+        try .init(self.impl.key.rawSignature(digest: digest))
     }
 }
 
@@ -123,13 +115,7 @@ extension P384.Signing.PublicKey {
     )
         -> Bool
     {
-        guard let baseSignature = try? ECDSASignature(rawRepresentation: signature.rawRepresentation)
-        else {
-            // If we can't create a signature, it's not valid.
-            return false
-        }
-
-        return self.impl.key.isValidSignature(baseSignature, for: digest)
+        self.impl.key.isValidRawSignature(signature.rawRepresentation, for: digest)
     }
 }
 
@@ -147,8 +133,7 @@ extension P521.Signing.ECDSASignature {
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension P521.Signing.PrivateKey {
     func openSSLSignature<D: Digest>(for digest: D) throws -> P521.Signing.ECDSASignature {
-        let baseSignature = try self.impl.key.sign(digest: digest)
-        return try .init(rawRepresentation: Data(rawSignature: baseSignature, over: P521.self))
+        try .init(self.impl.key.rawSignature(digest: digest))
     }
 }
 
@@ -160,13 +145,7 @@ extension P521.Signing.PublicKey {
     )
         -> Bool
     {
-        guard let baseSignature = try? ECDSASignature(rawRepresentation: signature.rawRepresentation)
-        else {
-            // If we can't create a signature, it's not valid.
-            return false
-        }
-
-        return self.impl.key.isValidSignature(baseSignature, for: digest)
+        self.impl.key.isValidRawSignature(signature.rawRepresentation, for: digest)
     }
 }
 #endif  // CRYPTO_IN_SWIFTPM && !CRYPTO_IN_SWIFTPM_FORCE_BUILD_API
@@ -32,12 +32,32 @@ public enum BoringSSLAEAD {
 extension BoringSSLAEAD {
     // Arguably this class is excessive, but it's probably better for this API to be as safe as possible
     // rather than rely on defer statements for our cleanup.
+    //
+    // The underlying EVP_AEAD_CTX is only written to in init and deinit: BoringSSL's seal and open operations
+    // take it as const. That makes it safe to share a single context across threads.
     @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
-    public class AEADContext {
+    public class AEADContext: @unchecked Sendable {
         private var context: EVP_AEAD_CTX
 
-        public init<Key: ContiguousBytes>(cipher: BoringSSLAEAD, key: Key) throws {
+        // Discontiguous messages are processed a region at a time by IncrementalContexts, which share this key
+        // state. It is only set up for contexts that expect discontiguous input, as it costs a second key schedule.
+        private let incrementalKey: BoringSSLAEAD.IncrementalKey?
+
+        /// Creates a context for `key`.
+        ///
+        /// If `preparingForDiscontiguousInput` is `true` and the cipher supports it, discontiguous messages and
+        /// authenticated data are processed a region at a time instead of being copied into contiguous storage first.
+        public init<Key: ContiguousBytes>(
+            cipher: BoringSSLAEAD,
+            key: Key,
+            preparingForDiscontiguousInput: Bool = false
+        ) throws {
             self.context = EVP_AEAD_CTX()
+            if preparingForDiscontiguousInput && cipher.supportsIncrementalProcessing {
+                self.incrementalKey = try BoringSSLAEAD.IncrementalKey(cipher: cipher, key: key)
+            } else {
+                self.incrementalKey = nil
+            }
 
             let rc: CInt = key.withUnsafeBytes { keyPointer in
                 withUnsafeMutablePointer(to: &self.context) { contextPointer in
@@ -63,6 +83,19 @@ extension BoringSSLAEAD {
                 CCryptoBoringSSL_EVP_AEAD_CTX_cleanup(contextPointer)
             }
         }
+
+        /// Whether discontiguous input is processed a region at a time.
+        var processesDiscontiguousInput: Bool {
+            self.incrementalKey != nil
+        }
+
+        /// Creates a context that processes a single message under this key a region at a time.
+        func makeIncrementalContext<Nonce: ContiguousBytes>(
+            nonce: Nonce,
+            operation: BoringSSLAEAD.IncrementalContext.Operation
+        ) throws -> BoringSSLAEAD.IncrementalContext {
+            try BoringSSLAEAD.IncrementalContext(key: self.incrementalKey!, nonce: nonce, operation: operation)
+        }
     }
 }
 
@@ -96,6 +129,9 @@ extension BoringSSLAEAD.AEADContext {
                 nonce: nonce,
                 authenticatedData: authenticatedData.regions.first!
             )
+        case _ where self.processesDiscontiguousInput:
+            // Feed the regions to the cipher one at a time, rather than flattening them first.
+            return try self._sealIncrementally(message: message, nonce: nonce, authenticatedData: authenticatedData)
         case (1, _):
             let contiguousAD = Array(authenticatedData)
             return try self._sealContiguous(
@@ -121,6 +157,46 @@ extension BoringSSLAEAD.AEADContext {
         }
     }
 
+    /// Seals discontiguous data without first copying it into contiguous storage.
+    func _sealIncrementally<
+        Plaintext: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        message: Plaintext,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData
+    ) throws -> (
+        ciphertext: Data, tag: Data
+    ) {
+        let messageByteCount = message.count
+        let tagByteCount = BoringSSLAEAD.IncrementalContext.tagByteCount
+
+        // We use malloc here because we are going to call free later. We force unwrap to trigger crashes if the allocation
+        // fails.
+        let outputBuffer = UnsafeMutableRawBufferPointer(start: malloc(messageByteCount)!, count: messageByteCount)
+        let tagBuffer = UnsafeMutableRawBufferPointer(start: malloc(tagByteCount)!, count: tagByteCount)
+
+        do {
+            let context = try self.makeIncrementalContext(nonce: nonce, operation: .seal)
+            try context.authenticate(authenticatedData)
+            try context.update(contentsOf: message, into: outputBuffer)
+            try context.finalize(tagInto: tagBuffer)
+        } catch {
+            free(outputBuffer.baseAddress)
+            free(tagBuffer.baseAddress)
+            throw error
+        }
+
+        let output = Data(
+            bytesNoCopy: outputBuffer.baseAddress!,
+            count: outputBuffer.count,
+            deallocator: .free
+        )
+        let tag = Data(bytesNoCopy: tagBuffer.baseAddress!, count: tagBuffer.count, deallocator: .free)
+        return (ciphertext: output, tag: tag)
+    }
+
     /// A fast-path for sealing contiguous data. Also inlinable to gain specialization information.
     @inlinable
     func _sealContiguous<
@@ -165,7 +241,7 @@ extension BoringSSLAEAD.AEADContext {
         let tagBuffer = UnsafeMutableRawBufferPointer(start: malloc(tagByteCount)!, count: tagByteCount)
         var actualTagSize = tagBuffer.count
 
-        let rc = withUnsafeMutablePointer(to: &self.context) { contextPointer in
+        let rc = withUnsafePointer(to: &self.context) { contextPointer in
             CCryptoBoringSSLShims_EVP_AEAD_CTX_seal_scatter(
                 contextPointer,
                 outputBuffer.baseAddress,
@@ -227,6 +303,24 @@ extension BoringSSLAEAD.AEADContext {
                 authenticatedData: authenticatedData.regions.first!
             )
         } else {
+            return try self._openDiscontiguous(
+                ciphertext: ciphertext,
+                nonce: nonce,
+                tag: tag,
+                authenticatedData: authenticatedData
+            )
+        }
+    }
+
+    /// Opens a message whose authenticated data is discontiguous: not inlinable so that it can touch private variables.
+    @usableFromInline
+    func _openDiscontiguous<Nonce: ContiguousBytes, AuthenticatedData: DataProtocol>(
+        ciphertext: Data,
+        nonce: Nonce,
+        tag: Data,
+        authenticatedData: AuthenticatedData
+    ) throws -> Data {
+        guard self.processesDiscontiguousInput else {
             let contiguousAD = Array(authenticatedData)
             return try self._openContiguous(
                 ciphertext: ciphertext,
@@ -235,6 +329,28 @@ extension BoringSSLAEAD.AEADContext {
                 authenticatedData: contiguousAD
             )
         }
+
+        // We use malloc here because we are going to call free later. We force unwrap to trigger crashes if the allocation
+        // fails.
+        let outputBuffer = UnsafeMutableRawBufferPointer(start: malloc(ciphertext.count)!, count: ciphertext.count)
+
+        do {
+            let context = try self.makeIncrementalContext(nonce: nonce, operation: .open)
+            try context.authenticate(authenticatedData)
+            try context.update(contentsOf: ciphertext, into: outputBuffer)
+            try tag.withUnsafeBytes { try context.finalize(verifying: $0) }
+        } catch {
+            // Don't leave unauthenticated plaintext lying around in freed memory.
+            CCryptoBoringSSL_OPENSSL_cleanse(outputBuffer.baseAddress, outputBuffer.count)
+            free(outputBuffer.baseAddress)
+            throw error
+        }
+
+        return Data(
+            bytesNoCopy: outputBuffer.baseAddress!,
+            count: outputBuffer.count,
+            deallocator: .free
+        )
     }
 
     /// A fast-path for opening contiguous data. Also inlinable to gain specialization information.
@@ -401,6 +517,461 @@ extension BoringSSLAEAD.AEADContext {
 
 }
 
+// MARK: - Sealing and opening into caller-provided memory
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension BoringSSLAEAD.AEADContext {
+    /// The number of bytes the authentication tag adds to every sealed message.
+    public var tagByteCount: Int {
+        CCryptoBoringSSL_EVP_AEAD_max_overhead(self.context.aead)
+    }
+
+    /// Seals a message into caller-provided memory, writing the ciphertext immediately followed by the tag.
+    ///
+    /// `output` must be at least `message.count + tagByteCount` bytes long. It may start at the same address as a
+    /// contiguous `message` to seal in place, but must not otherwise overlap it.
+    ///
+    /// - Returns: The number of bytes written to `output`.
+    public func seal<
+        Plaintext: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        message: Plaintext,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        switch (message.regions.count, authenticatedData.regions.count) {
+        case (1, 1):
+            return try self._sealContiguous(
+                message: message.regions.first!,
+                nonce: nonce,
+                authenticatedData: authenticatedData.regions.first!,
+                into: output
+            )
+        case _ where self.processesDiscontiguousInput:
+            return try self._sealIncrementally(
+                message: message,
+                nonce: nonce,
+                authenticatedData: authenticatedData,
+                into: output
+            )
+        case (1, _):
+            let contiguousAD = Array(authenticatedData)
+            return try self._sealContiguous(
+                message: message.regions.first!,
+                nonce: nonce,
+                authenticatedData: contiguousAD,
+                into: output
+            )
+        case (_, 1):
+            let contiguousMessage = Array(message)
+            return try self._sealContiguous(
+                message: contiguousMessage,
+                nonce: nonce,
+                authenticatedData: authenticatedData.regions.first!,
+                into: output
+            )
+        case (_, _):
+            let contiguousMessage = Array(message)
+            let contiguousAD = Array(authenticatedData)
+            return try self._sealContiguous(
+                message: contiguousMessage,
+                nonce: nonce,
+                authenticatedData: contiguousAD,
+                into: output
+            )
+        }
+    }
+
+    /// Seals a message, appending the ciphertext and then the tag to `output`.
+    public func seal<
+        Plaintext: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        message: Plaintext,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        appendingTo output: inout [UInt8]
+    ) throws {
+        let originalCount = output.count
+        output.append(contentsOf: repeatElement(0, count: message.count + self.tagByteCount))
+
+        do {
+            let writtenBytes = try output.withUnsafeMutableBytes { outputBytes in
+                try self.seal(
+                    message: message,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    into: UnsafeMutableRawBufferPointer(rebasing: outputBytes[originalCount...])
+                )
+            }
+            output.removeSubrange((originalCount + writtenBytes)...)
+        } catch {
+            output.removeSubrange(originalCount...)
+            throw error
+        }
+    }
+
+    /// Seals a message, appending the ciphertext and then the tag to `output`.
+    public func seal<
+        Plaintext: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        message: Plaintext,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        appendingTo output: inout Data
+    ) throws {
+        let originalCount = output.count
+        output.count += message.count + self.tagByteCount
+
+        do {
+            let writtenBytes = try output.withUnsafeMutableBytes { outputBytes in
+                try self.seal(
+                    message: message,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    into: UnsafeMutableRawBufferPointer(rebasing: outputBytes[originalCount...])
+                )
+            }
+            output.count = originalCount + writtenBytes
+        } catch {
+            output.count = originalCount
+            throw error
+        }
+    }
+
+    /// Seals discontiguous data into caller-provided memory without first copying it into contiguous storage.
+    func _sealIncrementally<
+        Plaintext: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        message: Plaintext,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        let messageByteCount = message.count
+        let tagByteCount = BoringSSLAEAD.IncrementalContext.tagByteCount
+        guard output.count >= tagByteCount, output.count - tagByteCount >= messageByteCount else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+
+        let context = try self.makeIncrementalContext(nonce: nonce, operation: .seal)
+        try context.authenticate(authenticatedData)
+        try context.update(contentsOf: message, into: output)
+        try context.finalize(tagInto: UnsafeMutableRawBufferPointer(rebasing: output[messageByteCount...]))
+        return messageByteCount + tagByteCount
+    }
+
+    /// A fast-path for sealing contiguous data into caller-provided memory.
+    @inlinable
+    func _sealContiguous<
+        Plaintext: ContiguousBytes,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: ContiguousBytes
+    >(
+        message: Plaintext,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        try message.withUnsafeBytes { messagePointer in
+            try nonce.withUnsafeBytes { noncePointer in
+                try authenticatedData.withUnsafeBytes { authenticatedDataPointer in
+                    try self._sealContiguous(
+                        plaintext: messagePointer,
+                        noncePointer: noncePointer,
+                        authenticatedData: authenticatedDataPointer,
+                        into: output
+                    )
+                }
+            }
+        }
+    }
+
+    /// The unsafe base call: not inlinable so that it can touch private variables.
+    @usableFromInline
+    func _sealContiguous(
+        plaintext: UnsafeRawBufferPointer,
+        noncePointer: UnsafeRawBufferPointer,
+        authenticatedData: UnsafeRawBufferPointer,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        guard output.count >= self.tagByteCount, output.count - self.tagByteCount >= plaintext.count else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+
+        var actualTagSize = 0
+        let rc = withUnsafePointer(to: &self.context) { contextPointer in
+            CCryptoBoringSSLShims_EVP_AEAD_CTX_seal_scatter(
+                contextPointer,
+                output.baseAddress,
+                output.baseAddress! + plaintext.count,
+                &actualTagSize,
+                output.count - plaintext.count,
+                noncePointer.baseAddress,
+                noncePointer.count,
+                plaintext.baseAddress,
+                plaintext.count,
+                nil,
+                0,
+                authenticatedData.baseAddress,
+                authenticatedData.count
+            )
+        }
+
+        guard rc == 1 else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        return plaintext.count + actualTagSize
+    }
+
+    /// Opens a sealed message, made of the ciphertext immediately followed by the tag, into caller-provided memory.
+    ///
+    /// `output` must be at least as long as the ciphertext. It may start at the same address as a contiguous
+    /// `combinedCiphertextAndTag` to open in place, but must not otherwise overlap it. If authentication fails the
+    /// plaintext bytes in `output` are zeroed.
+    ///
+    /// - Returns: The number of bytes written to `output`.
+    public func open<
+        CiphertextAndTag: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        combinedCiphertextAndTag: CiphertextAndTag,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        switch (combinedCiphertextAndTag.regions.count, authenticatedData.regions.count) {
+        case (1, 1):
+            return try self._openContiguous(
+                combinedCiphertextAndTag: combinedCiphertextAndTag.regions.first!,
+                nonce: nonce,
+                authenticatedData: authenticatedData.regions.first!,
+                into: output
+            )
+        case _ where self.processesDiscontiguousInput:
+            return try self._openIncrementally(
+                combinedCiphertextAndTag: combinedCiphertextAndTag,
+                nonce: nonce,
+                authenticatedData: authenticatedData,
+                into: output
+            )
+        case (1, _):
+            let contiguousAD = Array(authenticatedData)
+            return try self._openContiguous(
+                combinedCiphertextAndTag: combinedCiphertextAndTag.regions.first!,
+                nonce: nonce,
+                authenticatedData: contiguousAD,
+                into: output
+            )
+        case (_, 1):
+            let contiguousCiphertext = Array(combinedCiphertextAndTag)
+            return try self._openContiguous(
+                combinedCiphertextAndTag: contiguousCiphertext,
+                nonce: nonce,
+                authenticatedData: authenticatedData.regions.first!,
+                into: output
+            )
+        case (_, _):
+            let contiguousCiphertext = Array(combinedCiphertextAndTag)
+            let contiguousAD = Array(authenticatedData)
+            return try self._openContiguous(
+                combinedCiphertextAndTag: contiguousCiphertext,
+                nonce: nonce,
+                authenticatedData: contiguousAD,
+                into: output
+            )
+        }
+    }
+
+    /// Opens a sealed message, made of the ciphertext immediately followed by the tag, appending the plaintext to
+    /// `output`. If opening fails, `output` is restored to its original count and the bytes written past it are zeroed.
+    public func open<
+        CiphertextAndTag: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        combinedCiphertextAndTag: CiphertextAndTag,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        appendingTo output: inout [UInt8]
+    ) throws {
+        let originalCount = output.count
+        output.append(contentsOf: repeatElement(0, count: combinedCiphertextAndTag.count))
+
+        do {
+            let writtenBytes = try output.withUnsafeMutableBytes { outputBytes in
+                try self.open(
+                    combinedCiphertextAndTag: combinedCiphertextAndTag,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    into: UnsafeMutableRawBufferPointer(rebasing: outputBytes[originalCount...])
+                )
+            }
+            output.removeSubrange((originalCount + writtenBytes)...)
+        } catch {
+            // Shrinking the array leaves its storage in place, so clear the unauthenticated plaintext first.
+            output.withUnsafeMutableBytes { outputBytes in
+                let appendedBytes = UnsafeMutableRawBufferPointer(rebasing: outputBytes[originalCount...])
+                CCryptoBoringSSL_OPENSSL_cleanse(appendedBytes.baseAddress, appendedBytes.count)
+            }
+            output.removeSubrange(originalCount...)
+            throw error
+        }
+    }
+
+    /// Opens a sealed message, made of the ciphertext immediately followed by the tag, appending the plaintext to
+    /// `output`. If opening fails, `output` is restored to its original count and the bytes written past it are zeroed.
+    public func open<
+        CiphertextAndTag: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        combinedCiphertextAndTag: CiphertextAndTag,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        appendingTo output: inout Data
+    ) throws {
+        let originalCount = output.count
+        output.count += combinedCiphertextAndTag.count
+
+        do {
+            let writtenBytes = try output.withUnsafeMutableBytes { outputBytes in
+                try self.open(
+                    combinedCiphertextAndTag: combinedCiphertextAndTag,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    into: UnsafeMutableRawBufferPointer(rebasing: outputBytes[originalCount...])
+                )
+            }
+            output.count = originalCount + writtenBytes
+        } catch {
+            // Shrinking the data leaves its storage in place, so clear the unauthenticated plaintext first.
+            output.withUnsafeMutableBytes { outputBytes in
+                let appendedBytes = UnsafeMutableRawBufferPointer(rebasing: outputBytes[originalCount...])
+                CCryptoBoringSSL_OPENSSL_cleanse(appendedBytes.baseAddress, appendedBytes.count)
+            }
+            output.count = originalCount
+            throw error
+        }
+    }
+
+    /// Opens discontiguous data into caller-provided memory without first copying it into contiguous storage.
+    func _openIncrementally<
+        CiphertextAndTag: DataProtocol,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: DataProtocol
+    >(
+        combinedCiphertextAndTag: CiphertextAndTag,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        let tagByteCount = BoringSSLAEAD.IncrementalContext.tagByteCount
+        let combinedByteCount = combinedCiphertextAndTag.count
+        guard combinedByteCount >= tagByteCount else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+        let ciphertextByteCount = combinedByteCount - tagByteCount
+        guard output.count >= ciphertextByteCount else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+
+        // The tag may itself straddle regions, so gather it up before we start.
+        var tag: (UInt64, UInt64) = (0, 0)
+        withUnsafeMutableBytes(of: &tag) { tagBytes in
+            _ = combinedCiphertextAndTag.suffix(tagByteCount).copyBytes(to: tagBytes)
+        }
+
+        do {
+            let context = try self.makeIncrementalContext(nonce: nonce, operation: .open)
+            try context.authenticate(authenticatedData)
+            try context.update(contentsOf: combinedCiphertextAndTag.prefix(ciphertextByteCount), into: output)
+            try withUnsafeBytes(of: tag) { try context.finalize(verifying: $0) }
+        } catch {
+            CCryptoBoringSSL_OPENSSL_cleanse(output.baseAddress, ciphertextByteCount)
+            throw error
+        }
+
+        return ciphertextByteCount
+    }
+
+    /// A fast-path for opening contiguous data into caller-provided memory.
+    @inlinable
+    func _openContiguous<
+        CiphertextAndTag: ContiguousBytes,
+        Nonce: ContiguousBytes,
+        AuthenticatedData: ContiguousBytes
+    >(
+        combinedCiphertextAndTag: CiphertextAndTag,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        try combinedCiphertextAndTag.withUnsafeBytes { combinedCiphertextAndTagPointer in
+            try nonce.withUnsafeBytes { nonceBytes in
+                try authenticatedData.withUnsafeBytes { authenticatedDataBytes in
+                    try self._openContiguous(
+                        combinedCiphertextAndTag: combinedCiphertextAndTagPointer,
+                        nonceBytes: nonceBytes,
+                        authenticatedData: authenticatedDataBytes,
+                        into: output
+                    )
+                }
+            }
+        }
+    }
+
+    /// The unsafe base call: not inlinable so that it can touch private variables.
+    @usableFromInline
+    func _openContiguous(
+        combinedCiphertextAndTag: UnsafeRawBufferPointer,
+        nonceBytes: UnsafeRawBufferPointer,
+        authenticatedData: UnsafeRawBufferPointer,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        let tagByteCount = self.tagByteCount
+        guard combinedCiphertextAndTag.count >= tagByteCount else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+        let ciphertextByteCount = combinedCiphertextAndTag.count - tagByteCount
+        guard output.count >= ciphertextByteCount else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+
+        let rc = withUnsafePointer(to: &self.context) { contextPointer in
+            CCryptoBoringSSLShims_EVP_AEAD_CTX_open_gather(
+                contextPointer,
+                output.baseAddress,
+                nonceBytes.baseAddress,
+                nonceBytes.count,
+                combinedCiphertextAndTag.baseAddress,
+                ciphertextByteCount,
+                combinedCiphertextAndTag.baseAddress! + ciphertextByteCount,
+                tagByteCount,
+                authenticatedData.baseAddress,
+                authenticatedData.count
+            )
+        }
+
+        guard rc == 1 else {
+            CCryptoBoringSSL_OPENSSL_cleanse(output.baseAddress, ciphertextByteCount)
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        return ciphertextByteCount
+    }
+}
+
 // MARK: - Supported ciphers
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
@@ -0,0 +1,599 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_implementationOnly import CCryptoBoringSSL
+@_implementationOnly import CCryptoBoringSSLShims
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension BoringSSLAEAD {
+    /// Whether messages for this cipher can be sealed and opened a piece at a time.
+    ///
+    /// AES-GCM-SIV derives its IV from the whole plaintext, so it needs all of the message up front.
+    package var supportsIncrementalProcessing: Bool {
+        switch self {
+        case .aes128gcm, .aes192gcm, .aes256gcm, .chacha20:
+            return true
+        case .aes128gcmsiv, .aes256gcmsiv:
+            return false
+        }
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension BoringSSLAEAD {
+    /// The per-key state shared by every ``IncrementalContext`` for one key.
+    ///
+    /// For AES-GCM this is a cipher context that has already expanded the key: each message copies it and sets only
+    /// its own nonce. ChaCha20 has no key schedule, so for ChaCha20-Poly1305 this is just the key.
+    ///
+    /// Once created, the state is only ever read, so a single key can be shared across threads.
+    package final class IncrementalKey: @unchecked Sendable {
+        fileprivate enum Backing {
+            case aesGCM(UnsafeMutablePointer<EVP_CIPHER_CTX>)
+            case chaCha20Poly1305(UnsafeMutableRawBufferPointer)
+        }
+
+        fileprivate let backing: Backing
+
+        package init<Key: ContiguousBytes>(cipher: BoringSSLAEAD, key: Key) throws {
+            self.backing = try key.withUnsafeBytes { keyBytes in
+                switch cipher {
+                case .aes128gcm, .aes192gcm, .aes256gcm:
+                    return .aesGCM(try AESGCMState.makeKeyedContext(cipher: cipher, key: keyBytes))
+                case .chacha20:
+                    return .chaCha20Poly1305(try ChaCha20Poly1305State.makeKey(keyBytes))
+                case .aes128gcmsiv, .aes256gcmsiv:
+                    throw CryptoBoringWrapperError.invalidParameter
+                }
+            }
+        }
+
+        deinit {
+            switch self.backing {
+            case .aesGCM(let context):
+                // This also cleanses the key schedule.
+                CCryptoBoringSSL_EVP_CIPHER_CTX_free(context)
+            case .chaCha20Poly1305(let key):
+                CCryptoBoringSSL_OPENSSL_cleanse(key.baseAddress, key.count)
+                key.deallocate()
+            }
+        }
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension BoringSSLAEAD {
+    /// Seals or opens a single message a piece at a time.
+    ///
+    /// All of the authenticated data must be passed to `authenticate` before the first call to `update`. Once all of
+    /// the message has been passed to `update`, call `finalize(tagInto:)` when sealing or `finalize(verifying:)` when
+    /// opening. The context cannot be reused afterwards.
+    ///
+    /// When opening, `update` returns plaintext before the tag has been checked. Callers must not act on that
+    /// plaintext until `finalize(verifying:)` has returned successfully.
+    package final class IncrementalContext {
+        /// The size of the authentication tag produced and expected by all of the incremental ciphers.
+        package static let tagByteCount = 16
+
+        package enum Operation {
+            case seal
+            case open
+        }
+
+        private enum Phase {
+            case authenticating
+            case processing
+            case finalized
+        }
+
+        private enum Backing {
+            case aesGCM(AESGCMState)
+            case chaCha20Poly1305(ChaCha20Poly1305State)
+        }
+
+        package let operation: Operation
+        private let backing: Backing
+        private var phase: Phase
+
+        package init<Nonce: ContiguousBytes>(key: IncrementalKey, nonce: Nonce, operation: Operation) throws {
+            self.backing = try nonce.withUnsafeBytes { nonceBytes in
+                switch key.backing {
+                case .aesGCM(let keyedContext):
+                    return .aesGCM(try AESGCMState(keyedContext: keyedContext, nonce: nonceBytes, operation: operation))
+                case .chaCha20Poly1305:
+                    return .chaCha20Poly1305(
+                        try ChaCha20Poly1305State(key: key, nonce: nonceBytes, operation: operation)
+                    )
+                }
+            }
+            self.operation = operation
+            self.phase = .authenticating
+        }
+
+        /// Creates a context for a single message under a key that won't be used for any other incremental messages.
+        package convenience init<Key: ContiguousBytes, Nonce: ContiguousBytes>(
+            cipher: BoringSSLAEAD,
+            key: Key,
+            nonce: Nonce,
+            operation: Operation
+        ) throws {
+            try self.init(key: IncrementalKey(cipher: cipher, key: key), nonce: nonce, operation: operation)
+        }
+
+        /// Authenticates, but does not encrypt, `authenticatedData`.
+        package func authenticate(_ authenticatedData: UnsafeRawBufferPointer) throws {
+            guard self.phase == .authenticating else {
+                throw CryptoBoringWrapperError.invalidParameter
+            }
+
+            switch self.backing {
+            case .aesGCM(let state):
+                try state.authenticate(authenticatedData)
+            case .chaCha20Poly1305(let state):
+                try state.authenticate(authenticatedData)
+            }
+        }
+
+        /// Authenticates, but does not encrypt, every region of `authenticatedData`.
+        package func authenticate<AuthenticatedData: DataProtocol>(_ authenticatedData: AuthenticatedData) throws {
+            for region in authenticatedData.regions {
+                try region.withUnsafeBytes { try self.authenticate($0) }
+            }
+        }
+
+        /// Encrypts or decrypts `input`, writing the same number of bytes to the start of `output`.
+        ///
+        /// `output` may start at the same address as `input`, but must not otherwise overlap it.
+        ///
+        /// - Returns: The number of bytes written to `output`.
+        @discardableResult
+        package func update(_ input: UnsafeRawBufferPointer, into output: UnsafeMutableRawBufferPointer) throws -> Int {
+            guard self.phase != .finalized else {
+                throw CryptoBoringWrapperError.invalidParameter
+            }
+            guard output.count >= input.count else {
+                throw CryptoBoringWrapperError.incorrectParameterSize
+            }
+            self.phase = .processing
+
+            switch self.backing {
+            case .aesGCM(let state):
+                try state.update(input, into: output)
+            case .chaCha20Poly1305(let state):
+                try state.update(input, into: output)
+            }
+            return input.count
+        }
+
+        /// Encrypts or decrypts every region of `input`, writing the results one after another to `output`.
+        ///
+        /// - Returns: The number of bytes written to `output`.
+        @discardableResult
+        package func update<Input: DataProtocol>(
+            contentsOf input: Input,
+            into output: UnsafeMutableRawBufferPointer
+        ) throws -> Int {
+            // Check up front, so that a short buffer doesn't leave us part way through the input.
+            guard output.count >= input.count else {
+                throw CryptoBoringWrapperError.incorrectParameterSize
+            }
+
+            var writtenBytes = 0
+            for region in input.regions {
+                writtenBytes += try region.withUnsafeBytes { regionBytes in
+                    try self.update(
+                        regionBytes,
+                        into: UnsafeMutableRawBufferPointer(rebasing: output[writtenBytes...])
+                    )
+                }
+            }
+            return writtenBytes
+        }
+
+        /// Completes sealing the message, writing the authentication tag to the start of `tag`.
+        ///
+        /// - Returns: The number of bytes written to `tag`.
+        @discardableResult
+        package func finalize(tagInto tag: UnsafeMutableRawBufferPointer) throws -> Int {
+            guard self.operation == .seal, self.phase != .finalized else {
+                throw CryptoBoringWrapperError.invalidParameter
+            }
+            guard tag.count >= Self.tagByteCount else {
+                throw CryptoBoringWrapperError.incorrectParameterSize
+            }
+            self.phase = .finalized
+
+            let tag = UnsafeMutableRawBufferPointer(rebasing: tag.prefix(Self.tagByteCount))
+            switch self.backing {
+            case .aesGCM(let state):
+                try state.finalize(tagInto: tag)
+            case .chaCha20Poly1305(let state):
+                state.finalize(tagInto: tag)
+            }
+            return Self.tagByteCount
+        }
+
+        /// Completes opening the message, throwing if `tag` does not authenticate it.
+        package func finalize(verifying tag: UnsafeRawBufferPointer) throws {
+            guard self.operation == .open, self.phase != .finalized else {
+                throw CryptoBoringWrapperError.invalidParameter
+            }
+            self.phase = .finalized
+
+            guard tag.count == Self.tagByteCount else {
+                throw Self.authenticationFailure()
+            }
+
+            switch self.backing {
+            case .aesGCM(let state):
+                try state.finalize(verifying: tag)
+            case .chaCha20Poly1305(let state):
+                try state.finalize(verifying: tag)
+            }
+        }
+
+        /// The error for a message that fails to authenticate.
+        ///
+        /// This is the same error that `EVP_AEAD_CTX_open` reports, so that callers see the same failure whether or not
+        /// a message was processed incrementally.
+        fileprivate static func authenticationFailure() -> CryptoBoringWrapperError {
+            CCryptoBoringSSLShims_ERR_put_bad_decrypt()
+            return CryptoBoringWrapperError.internalBoringSSLError()
+        }
+    }
+}
+
+// MARK: - AES-GCM
+
+/// Incremental AES-GCM, implemented on top of the `EVP_CIPHER` interface, which drives the same GCM128 machinery as
+/// the `EVP_AEAD` one.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+private final class AESGCMState {
+    // EVP_CipherUpdate takes an int length, so we feed it at most this many bytes at a time.
+    private static let maximumUpdateByteCount = 1 << 30
+
+    private let context: UnsafeMutablePointer<EVP_CIPHER_CTX>
+
+    /// Creates a cipher context with the key schedule set up, but no nonce, for messages to copy.
+    static func makeKeyedContext(
+        cipher: BoringSSLAEAD,
+        key: UnsafeRawBufferPointer
+    ) throws -> UnsafeMutablePointer<EVP_CIPHER_CTX> {
+        let evpCipher: OpaquePointer
+        switch cipher {
+        case .aes128gcm:
+            evpCipher = CCryptoBoringSSL_EVP_aes_128_gcm()
+        case .aes192gcm:
+            evpCipher = CCryptoBoringSSL_EVP_aes_192_gcm()
+        case .aes256gcm:
+            evpCipher = CCryptoBoringSSL_EVP_aes_256_gcm()
+        case .aes128gcmsiv, .aes256gcmsiv, .chacha20:
+            throw CryptoBoringWrapperError.invalidParameter
+        }
+
+        guard key.count == Int(CCryptoBoringSSL_EVP_CIPHER_key_length(evpCipher)) else {
+            throw CryptoBoringWrapperError.incorrectKeySize
+        }
+        guard let context = CCryptoBoringSSL_EVP_CIPHER_CTX_new() else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+        guard CCryptoBoringSSLShims_EVP_CipherInit_ex(context, evpCipher, nil, key.baseAddress, nil, 1) == 1 else {
+            CCryptoBoringSSL_EVP_CIPHER_CTX_free(context)
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+        return context
+    }
+
+    init(
+        keyedContext: UnsafeMutablePointer<EVP_CIPHER_CTX>,
+        nonce: UnsafeRawBufferPointer,
+        operation: BoringSSLAEAD.IncrementalContext.Operation
+    ) throws {
+        guard nonce.count > 0, nonce.count <= Int(CInt.max) else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+        guard let context = CCryptoBoringSSL_EVP_CIPHER_CTX_new() else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        // Copying the keyed context reuses its key schedule and GHASH key. The nonce length has to be set before the
+        // nonce itself.
+        let encrypt: CInt = operation == .seal ? 1 : 0
+        guard
+            CCryptoBoringSSL_EVP_CIPHER_CTX_copy(context, keyedContext) == 1,
+            CCryptoBoringSSL_EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_AEAD_SET_IVLEN, CInt(nonce.count), nil) == 1,
+            CCryptoBoringSSLShims_EVP_CipherInit_ex(context, nil, nil, nil, nonce.baseAddress, encrypt) == 1
+        else {
+            CCryptoBoringSSL_EVP_CIPHER_CTX_free(context)
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        self.context = context
+    }
+
+    deinit {
+        // This also cleanses the copy of the key schedule.
+        CCryptoBoringSSL_EVP_CIPHER_CTX_free(self.context)
+    }
+
+    func authenticate(_ authenticatedData: UnsafeRawBufferPointer) throws {
+        // Passing a null output pointer tells the GCM cipher that the input is authenticated data.
+        try self.cipherUpdate(input: authenticatedData, output: nil)
+    }
+
+    func update(_ input: UnsafeRawBufferPointer, into output: UnsafeMutableRawBufferPointer) throws {
+        try self.cipherUpdate(input: input, output: output.baseAddress)
+    }
+
+    private func cipherUpdate(input: UnsafeRawBufferPointer, output: UnsafeMutableRawPointer?) throws {
+        var offset = 0
+        while offset < input.count {
+            let chunkByteCount = min(input.count - offset, Self.maximumUpdateByteCount)
+            var writtenBytes: CInt = 0
+            let rc = CCryptoBoringSSLShims_EVP_CipherUpdate(
+                self.context,
+                output.map { $0 + offset },
+                &writtenBytes,
+                input.baseAddress! + offset,
+                CInt(chunkByteCount)
+            )
+            guard rc == 1 else {
+                throw CryptoBoringWrapperError.internalBoringSSLError()
+            }
+            offset += chunkByteCount
+        }
+    }
+
+    func finalize(tagInto tag: UnsafeMutableRawBufferPointer) throws {
+        var writtenBytes: CInt = 0
+        guard
+            CCryptoBoringSSLShims_EVP_CipherFinal_ex(self.context, nil, &writtenBytes) == 1,
+            CCryptoBoringSSL_EVP_CIPHER_CTX_ctrl(self.context, EVP_CTRL_AEAD_GET_TAG, CInt(tag.count), tag.baseAddress)
+                == 1
+        else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+    }
+
+    func finalize(verifying tag: UnsafeRawBufferPointer) throws {
+        let rc = CCryptoBoringSSL_EVP_CIPHER_CTX_ctrl(
+            self.context,
+            EVP_CTRL_AEAD_SET_TAG,
+            CInt(tag.count),
+            UnsafeMutableRawPointer(mutating: tag.baseAddress)
+        )
+        guard rc == 1 else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        // The final call compares the tag in constant time.
+        var writtenBytes: CInt = 0
+        guard CCryptoBoringSSLShims_EVP_CipherFinal_ex(self.context, nil, &writtenBytes) == 1 else {
+            throw BoringSSLAEAD.IncrementalContext.authenticationFailure()
+        }
+    }
+}
+
+// MARK: - ChaCha20-Poly1305
+
+/// Incremental ChaCha20-Poly1305, as defined in RFC 8439, built from the ChaCha20 and Poly1305 primitives.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+private final class ChaCha20Poly1305State {
+    private static let blockByteCount = 64
+
+    // RFC 8439 limits a single message to 2^32 - 1 blocks, as block 0 is used to derive the Poly1305 key.
+    private static let maximumMessageByteCount = UInt64(UInt32.max) * UInt64(blockByteCount)
+
+    private let operation: BoringSSLAEAD.IncrementalContext.Operation
+    // The key is shared with every other message under it, rather than copied for each one. We hold on to the
+    // IncrementalKey to keep the key bytes alive.
+    private let key: BoringSSLAEAD.IncrementalKey
+    private let keyBytes: UnsafeMutableRawBufferPointer
+    private var nonce: (UInt32, UInt32, UInt32)
+    private var counter: UInt32
+
+    // The unused tail of the last keystream block we generated, for messages that are not passed in whole blocks.
+    private var keystream: (UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64)
+    private var keystreamOffset: Int
+
+    private let poly1305State: UnsafeMutableRawPointer
+    private var authenticatedDataByteCount: UInt64
+    private var messageByteCount: UInt64
+    private var authenticatedDataIsPadded: Bool
+
+    /// Copies `key` into memory of its own, for an ``BoringSSLAEAD/IncrementalKey`` to own.
+    static func makeKey(_ key: UnsafeRawBufferPointer) throws -> UnsafeMutableRawBufferPointer {
+        guard key.count == 32 else {
+            throw CryptoBoringWrapperError.incorrectKeySize
+        }
+        let keyCopy = UnsafeMutableRawBufferPointer.allocate(byteCount: key.count, alignment: 8)
+        keyCopy.copyMemory(from: key)
+        return keyCopy
+    }
+
+    init(
+        key: BoringSSLAEAD.IncrementalKey,
+        nonce: UnsafeRawBufferPointer,
+        operation: BoringSSLAEAD.IncrementalContext.Operation
+    ) throws {
+        guard case .chaCha20Poly1305(let keyBytes) = key.backing else {
+            throw CryptoBoringWrapperError.invalidParameter
+        }
+        guard nonce.count == 12 else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+
+        self.operation = operation
+        self.key = key
+        self.keyBytes = keyBytes
+        self.nonce = (0, 0, 0)
+        self.counter = 1
+        self.keystream = (0, 0, 0, 0, 0, 0, 0, 0)
+        self.keystreamOffset = Self.blockByteCount
+        // poly1305_state is an opaque 512 byte buffer which BoringSSL aligns itself.
+        self.poly1305State = UnsafeMutableRawPointer.allocate(byteCount: 512, alignment: 16)
+        self.authenticatedDataByteCount = 0
+        self.messageByteCount = 0
+        self.authenticatedDataIsPadded = false
+
+        withUnsafeMutableBytes(of: &self.nonce) { $0.copyMemory(from: nonce) }
+
+        // The Poly1305 key is the first 32 bytes of keystream block 0.
+        var poly1305Key: (UInt64, UInt64, UInt64, UInt64) = (0, 0, 0, 0)
+        withUnsafeMutableBytes(of: &poly1305Key) { poly1305KeyBytes in
+            self.chacha20(poly1305KeyBytes.baseAddress!, poly1305KeyBytes.baseAddress!, poly1305KeyBytes.count, 0)
+            CCryptoBoringSSLShims_CRYPTO_poly1305_init(self.poly1305State, poly1305KeyBytes.baseAddress)
+            CCryptoBoringSSL_OPENSSL_cleanse(poly1305KeyBytes.baseAddress, poly1305KeyBytes.count)
+        }
+    }
+
+    deinit {
+        withUnsafeMutableBytes(of: &self.keystream) { CCryptoBoringSSL_OPENSSL_cleanse($0.baseAddress, $0.count) }
+        CCryptoBoringSSL_OPENSSL_cleanse(self.poly1305State, 512)
+        self.poly1305State.deallocate()
+    }
+
+    func authenticate(_ authenticatedData: UnsafeRawBufferPointer) throws {
+        CCryptoBoringSSLShims_CRYPTO_poly1305_update(
+            self.poly1305State,
+            authenticatedData.baseAddress,
+            authenticatedData.count
+        )
+        self.authenticatedDataByteCount += UInt64(authenticatedData.count)
+    }
+
+    func update(_ input: UnsafeRawBufferPointer, into output: UnsafeMutableRawBufferPointer) throws {
+        guard UInt64(input.count) <= Self.maximumMessageByteCount - self.messageByteCount else {
+            throw CryptoBoringWrapperError.incorrectParameterSize
+        }
+        guard input.count > 0 else {
+            return
+        }
+        self.padAuthenticatedDataIfNeeded()
+
+        // Poly1305 authenticates the ciphertext. When opening we must absorb it before decrypting, as the output may
+        // overwrite the input.
+        if self.operation == .open {
+            CCryptoBoringSSLShims_CRYPTO_poly1305_update(self.poly1305State, input.baseAddress, input.count)
+        }
+
+        var offset = 0
+
+        // First use up any keystream left over from the previous call.
+        if self.keystreamOffset < Self.blockByteCount {
+            let byteCount = min(Self.blockByteCount - self.keystreamOffset, input.count)
+            withUnsafeBytes(of: &self.keystream) { keystream in
+                for index in 0..<byteCount {
+                    output[index] = input[index] ^ keystream[self.keystreamOffset + index]
+                }
+            }
+            self.keystreamOffset += byteCount
+            offset = byteCount
+        }
+
+        // Then hand all the whole blocks to ChaCha20 directly.
+        let wholeBlockByteCount = (input.count - offset) / Self.blockByteCount * Self.blockByteCount
+        if wholeBlockByteCount > 0 {
+            self.chacha20(output.baseAddress! + offset, input.baseAddress! + offset, wholeBlockByteCount, self.counter)
+            self.counter &+= UInt32(truncatingIfNeeded: wholeBlockByteCount / Self.blockByteCount)
+            offset += wholeBlockByteCount
+        }
+
+        // Finally, generate one more block of keystream for any trailing bytes and keep the rest for later.
+        if offset < input.count {
+            let byteCount = input.count - offset
+            let counter = self.counter
+            withUnsafeMutableBytes(of: &self.keystream) { keystream in
+                keystream.initializeMemory(as: UInt8.self, repeating: 0)
+                self.chacha20(keystream.baseAddress!, keystream.baseAddress!, keystream.count, counter)
+                for index in 0..<byteCount {
+                    output[offset + index] = input[offset + index] ^ keystream[index]
+                }
+            }
+            self.counter &+= 1
+            self.keystreamOffset = byteCount
+        }
+
+        if self.operation == .seal {
+            CCryptoBoringSSLShims_CRYPTO_poly1305_update(self.poly1305State, output.baseAddress, input.count)
+        }
+        self.messageByteCount += UInt64(input.count)
+    }
+
+    func finalize(tagInto tag: UnsafeMutableRawBufferPointer) {
+        self.finishPoly1305(into: tag)
+    }
+
+    func finalize(verifying tag: UnsafeRawBufferPointer) throws {
+        var computedTag: (UInt64, UInt64) = (0, 0)
+        let tagsMatch = withUnsafeMutableBytes(of: &computedTag) { computedTagBytes in
+            self.finishPoly1305(into: computedTagBytes)
+            return CCryptoBoringSSL_CRYPTO_memcmp(computedTagBytes.baseAddress, tag.baseAddress, tag.count) == 0
+        }
+        guard tagsMatch else {
+            throw BoringSSLAEAD.IncrementalContext.authenticationFailure()
+        }
+    }
+
+    private func finishPoly1305(into tag: UnsafeMutableRawBufferPointer) {
+        self.padAuthenticatedDataIfNeeded()
+        self.pad(self.messageByteCount)
+
+        var lengths = (self.authenticatedDataByteCount.littleEndian, self.messageByteCount.littleEndian)
+        withUnsafeBytes(of: &lengths) { lengthBytes in
+            CCryptoBoringSSLShims_CRYPTO_poly1305_update(self.poly1305State, lengthBytes.baseAddress, lengthBytes.count)
+        }
+        CCryptoBoringSSLShims_CRYPTO_poly1305_finish(self.poly1305State, tag.baseAddress)
+    }
+
+    private func padAuthenticatedDataIfNeeded() {
+        if !self.authenticatedDataIsPadded {
+            self.pad(self.authenticatedDataByteCount)
+            self.authenticatedDataIsPadded = true
+        }
+    }
+
+    /// Pads the Poly1305 input with zeros up to the next multiple of 16 bytes, given that `byteCount` bytes have been
+    /// absorbed since the last padding.
+    private func pad(_ byteCount: UInt64) {
+        let paddingByteCount = Int((16 - byteCount % 16) % 16)
+        guard paddingByteCount > 0 else {
+            return
+        }
+
+        let zeros: (UInt64, UInt64) = (0, 0)
+        withUnsafeBytes(of: zeros) { zeroBytes in
+            CCryptoBoringSSLShims_CRYPTO_poly1305_update(self.poly1305State, zeroBytes.baseAddress, paddingByteCount)
+        }
+    }
+
+    private func chacha20(
+        _ output: UnsafeMutableRawPointer,
+        _ input: UnsafeRawPointer,
+        _ byteCount: Int,
+        _ counter: UInt32
+    ) {
+        withUnsafeBytes(of: self.nonce) { nonceBytes in
+            CCryptoBoringSSLShims_CRYPTO_chacha_20(
+                output,
+                input,
+                byteCount,
+                self.keyBytes.baseAddress,
+                nonceBytes.baseAddress,
+                counter
+            )
+        }
+    }
+}
@@ -89,6 +89,18 @@ package struct EllipticCurvePoint: @unchecked Sendable {
         try lhs.multiplying(by: rhs, on: group, context: context)
     }
 
+    /// Computes the sum of `scalar * point` over all the terms with a single multi-scalar multiplication.
+    ///
+    /// This runs in variable time, so it must only be used when the scalars and points are public, as when verifying
+    /// a proof. Each scalar must be non-negative and less than the group order.
+    @usableFromInline
+    package init(
+        publicMultiScalarMultiplication terms: [(scalar: ArbitraryPrecisionInteger, point: EllipticCurvePoint)],
+        on group: BoringSSLEllipticCurveGroup
+    ) throws {
+        self.backing = try .init(publicMultiScalarMultiplication: terms, on: group)
+    }
+
     @usableFromInline
     package mutating func add(
         _ rhs: EllipticCurvePoint,
@@ -247,6 +259,56 @@ package struct EllipticCurvePoint: @unchecked Sendable {
         try self.backing.x962Representation(compressed: compressed, on: group, context: context)
     }
 
+    /// Returns the X9.62 representations of `points`, in order.
+    ///
+    /// Serializing needs each point in affine coordinates, which costs a field inversion. This shares a single
+    /// inversion across all the points where the group supports it, so it is much cheaper than serializing each point
+    /// on its own. None of the points may be the point at infinity.
+    @usableFromInline
+    package static func x962Representations(
+        of points: [EllipticCurvePoint],
+        compressed: Bool,
+        on group: BoringSSLEllipticCurveGroup
+    ) throws -> [Data] {
+        guard let firstPoint = points.first else {
+            return []
+        }
+        let form = compressed ? POINT_CONVERSION_COMPRESSED : POINT_CONVERSION_UNCOMPRESSED
+        let pointByteCount = group.withUnsafeGroupPointer { groupPtr in
+            firstPoint.withPointPointer { pointPtr in
+                CCryptoBoringSSL_EC_POINT_point2oct(groupPtr, pointPtr, form, nil, 0, nil)
+            }
+        }
+        guard pointByteCount != 0 else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        var buf = Data(repeating: 0, count: points.count * pointByteCount)
+        // Each EC_POINT is owned by its point's backing object, so the pointers stay valid while `points` is alive.
+        let numBytesWritten = withExtendedLifetime(points) {
+            let pointPtrs: [OpaquePointer?] = points.map { $0.withPointPointer { $0 } }
+            return group.withUnsafeGroupPointer { groupPtr in
+                buf.withUnsafeMutableBytes { bufPtr in
+                    CCryptoBoringSSL_EC_POINT_point2oct_batch(
+                        groupPtr,
+                        pointPtrs,
+                        pointPtrs.count,
+                        form,
+                        bufPtr.baseAddress?.assumingMemoryBound(to: UInt8.self),
+                        bufPtr.count
+                    )
+                }
+            }
+        }
+        guard numBytesWritten == buf.count else {
+            throw CryptoBoringWrapperError.internalBoringSSLError()
+        }
+
+        return (0..<points.count).map { index in
+            Data(buf[(index * pointByteCount)..<((index + 1) * pointByteCount)])
+        }
+    }
+
     private mutating func cowIfNeeded(on group: BoringSSLEllipticCurveGroup) throws {
         if !isKnownUniquelyReferenced(&self.backing) {
             self.backing = try .init(copying: self.backing, on: group)
@@ -316,6 +378,46 @@ extension EllipticCurvePoint {
             }
         }
 
+        fileprivate convenience init(
+            publicMultiScalarMultiplication terms: [(scalar: ArbitraryPrecisionInteger, point: EllipticCurvePoint)],
+            on group: BoringSSLEllipticCurveGroup
+        ) throws {
+            try self.init(_pointAtInfinityOn: group)
+
+            // The point pointers, and the words that the copied BIGNUM headers point to, stay valid for as long as
+            // `terms` keeps the points and scalars alive. The copies are never freed, so they don't take ownership.
+            try withExtendedLifetime(terms) {
+                try withUnsafeTemporaryAllocation(of: OpaquePointer?.self, capacity: terms.count) { points in
+                    try withUnsafeTemporaryAllocation(of: BIGNUM.self, capacity: terms.count) { bignums in
+                        try withUnsafeTemporaryAllocation(
+                            of: UnsafePointer<BIGNUM>?.self,
+                            capacity: terms.count
+                        ) { scalars in
+                            for (index, term) in terms.enumerated() {
+                                points.initializeElement(at: index, to: term.point.withPointPointer { $0 })
+                                let bignum = term.scalar.withUnsafeBignumPointer { $0.pointee }
+                                bignums.initializeElement(at: index, to: bignum)
+                                scalars.initializeElement(at: index, to: UnsafePointer(bignums.baseAddress! + index))
+                            }
+                            try group.withUnsafeGroupPointer { groupPtr in
+                                guard
+                                    CCryptoBoringSSL_EC_POINT_mul_public_batch(
+                                        groupPtr,
+                                        self._basePoint,
+                                        points.baseAddress,
+                                        scalars.baseAddress,
+                                        terms.count
+                                    ) == 1
+                                else {
+                                    throw CryptoBoringWrapperError.internalBoringSSLError()
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
         deinit {
             CCryptoBoringSSL_EC_POINT_free(self._basePoint)
         }
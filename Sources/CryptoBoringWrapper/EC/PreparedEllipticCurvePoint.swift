@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+@_implementationOnly import CCryptoBoringSSL
+
+/// An elliptic curve point with a precomputed table of its multiples.
+///
+/// Multiplying a prepared point is several times faster than multiplying an ``EllipticCurvePoint`` on curves that
+/// support it, but preparing one costs about as much as a multiplication. Use it for fixed generators and long-lived
+/// public keys. The table is immutable, so a prepared point can be shared freely.
+@usableFromInline
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+package final class PreparedEllipticCurvePoint: @unchecked Sendable {
+    @usableFromInline
+    let _precomp: OpaquePointer
+
+    @usableFromInline
+    package init(_ point: EllipticCurvePoint, on group: BoringSSLEllipticCurveGroup) throws {
+        self._precomp = try group.withUnsafeGroupPointer { groupPtr in
+            try point.withPointPointer { pointPtr in
+                guard let precomp = CCryptoBoringSSL_EC_POINT_PRECOMP_new(groupPtr, pointPtr) else {
+                    throw CryptoBoringWrapperError.internalBoringSSLError()
+                }
+                return precomp
+            }
+        }
+    }
+
+    deinit {
+        CCryptoBoringSSL_EC_POINT_PRECOMP_free(self._precomp)
+    }
+
+    /// Returns `scalar` times this point. The scalar must be non-negative and less than the group order.
+    @usableFromInline
+    package func multiplied(
+        by scalar: ArbitraryPrecisionInteger,
+        on group: BoringSSLEllipticCurveGroup
+    ) throws -> EllipticCurvePoint {
+        let result = try EllipticCurvePoint(_pointAtInfinityOn: group)
+        try result.withPointPointer { resultPtr in
+            try group.withUnsafeGroupPointer { groupPtr in
+                try scalar.withUnsafeBignumPointer { scalarPtr in
+                    guard
+                        CCryptoBoringSSL_EC_POINT_mul_precomp(groupPtr, resultPtr, self._precomp, scalarPtr, nil, nil)
+                            == 1
+                    else {
+                        throw CryptoBoringWrapperError.internalBoringSSLError()
+                    }
+                }
+            }
+        }
+        return result
+    }
+
+    @inlinable
+    package func withUnsafePrecompPointer<T>(_ body: (OpaquePointer) throws -> T) rethrows -> T {
+        try body(self._precomp)
+    }
+}
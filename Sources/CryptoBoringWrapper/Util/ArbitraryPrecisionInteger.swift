@@ -166,6 +166,28 @@ extension ArbitraryPrecisionInteger {
 
         return try self._backing.withUnsafeMutableBignumPointer(body)
     }
+
+    /// Calls `body` with somewhere to write a new value for `self`, and the current value of `self`.
+    ///
+    /// This is for mutating operations that compute a new value from the current one. If the storage is not shared
+    /// the two pointers are the same, and the result reuses its memory. Otherwise the result is written to fresh
+    /// storage, which saves copying a value that is about to be overwritten.
+    fileprivate mutating func withUnsafeResultBignumPointer<T>(
+        _ body: (UnsafeMutablePointer<BIGNUM>, UnsafePointer<BIGNUM>) throws -> T
+    ) rethrows -> T {
+        if isKnownUniquelyReferenced(&self._backing) {
+            return try self._backing.withUnsafeMutableBignumPointer { try body($0, $0) }
+        }
+
+        let result = BackingStorage()
+        let rc = try result.withUnsafeMutableBignumPointer { resultPtr in
+            try self._backing.withUnsafeBignumPointer { selfPtr in
+                try body(resultPtr, selfPtr)
+            }
+        }
+        self._backing = result
+        return rc
+    }
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
@@ -243,10 +265,26 @@ extension ArbitraryPrecisionInteger {
         }
     }
 
-    /// Some functions require a BN_CTX parameter: this obtains one with a scoped lifetime.
+    /// Some functions require a BN_CTX parameter: this obtains one for the duration of `body`.
+    ///
+    /// This is the calling thread's shared BN_CTX, so that the temporaries it holds are reused across operations
+    /// rather than being allocated and freed by each of them. BoringSSL's functions balance their own use of it, so
+    /// it is safe to use from nested calls.
+    ///
+    /// Many of these integers are secret, such as private keys and blinding factors, so the temporaries are erased
+    /// once `body` returns rather than left in the pool for the next operation to overwrite. Only those that no
+    /// enclosing call is still using are erased.
     private static func withUnsafeBN_CTX<T>(_ body: (OpaquePointer) throws -> T) rethrows -> T {
-        // We force unwrap here because this call can only fail if the allocator is broken, and if
-        // the allocator fails we don't have long to live anyway.
+        if let bnCtx = CCryptoBoringSSL_BN_CTX_get_thread_local() {
+            defer {
+                CCryptoBoringSSL_BN_CTX_cleanse(bnCtx)
+            }
+            return try body(bnCtx)
+        }
+
+        // The shared context is unavailable if it couldn't be allocated or an earlier operation on it failed, so
+        // fall back to a context of our own. We force unwrap here because this call can only fail if the allocator
+        // is broken, and if the allocator fails we don't have long to live anyway.
         let bnCtx = CCryptoBoringSSL_BN_CTX_new()!
         defer {
             CCryptoBoringSSL_BN_CTX_free(bnCtx)
@@ -328,9 +366,9 @@ extension ArbitraryPrecisionInteger: AdditiveArithmetic {
 
     @usableFromInline
     package static func += (lhs: inout ArbitraryPrecisionInteger, rhs: ArbitraryPrecisionInteger) {
-        let rc = lhs.withUnsafeMutableBignumPointer { lhsPtr in
+        let rc = lhs.withUnsafeResultBignumPointer { resultPtr, lhsPtr in
             rhs.withUnsafeBignumPointer { rhsPtr in
-                CCryptoBoringSSL_BN_add(lhsPtr, lhsPtr, rhsPtr)
+                CCryptoBoringSSL_BN_add(resultPtr, lhsPtr, rhsPtr)
             }
         }
         precondition(rc == 1, "Unable to allocate memory for new ArbitraryPrecisionInteger")
@@ -359,9 +397,9 @@ extension ArbitraryPrecisionInteger: AdditiveArithmetic {
 
     @usableFromInline
     package static func -= (lhs: inout ArbitraryPrecisionInteger, rhs: ArbitraryPrecisionInteger) {
-        let rc = lhs.withUnsafeMutableBignumPointer { lhsPtr in
+        let rc = lhs.withUnsafeResultBignumPointer { resultPtr, lhsPtr in
             rhs.withUnsafeBignumPointer { rhsPtr in
-                CCryptoBoringSSL_BN_sub(lhsPtr, lhsPtr, rhsPtr)
+                CCryptoBoringSSL_BN_sub(resultPtr, lhsPtr, rhsPtr)
             }
         }
         precondition(rc == 1, "Unable to allocate memory for new ArbitraryPrecisionInteger")
@@ -415,10 +453,10 @@ extension ArbitraryPrecisionInteger: Numeric {
 
     @usableFromInline
     package static func *= (lhs: inout ArbitraryPrecisionInteger, rhs: ArbitraryPrecisionInteger) {
-        let rc = lhs.withUnsafeMutableBignumPointer { lhsPtr in
+        let rc = lhs.withUnsafeResultBignumPointer { resultPtr, lhsPtr in
             rhs.withUnsafeBignumPointer { rhsPtr in
                 ArbitraryPrecisionInteger.withUnsafeBN_CTX { bnCtx in
-                    CCryptoBoringSSL_BN_mul(lhsPtr, lhsPtr, rhsPtr, bnCtx)
+                    CCryptoBoringSSL_BN_mul(resultPtr, lhsPtr, rhsPtr, bnCtx)
                 }
             }
         }
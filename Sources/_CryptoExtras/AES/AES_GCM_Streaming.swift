@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// NOTE: This file is unconditionally compiled because streaming AES-GCM is implemented using BoringSSL on all platforms.
+import Crypto
+import CryptoBoringWrapper
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension AES.GCM {
+    /// Seals a single AES-GCM message a piece at a time, under a key of 128, 192 or 256 bits.
+    ///
+    /// The ciphertext and tag are the same as the ones ``AES/GCM/seal(_:using:nonce:authenticating:)`` produces for
+    /// the whole message, so either can be opened with ``AES/GCM/_Decryptor`` or
+    /// ``AES/GCM/open(_:using:authenticating:)``.
+    public typealias _Encryptor = _AEADEncryptor<AES.GCM>
+
+    /// Opens a single AES-GCM message a piece at a time.
+    ///
+    /// - Important: The plaintext is unauthenticated until the decryptor has been finalized. If the message needs to
+    ///   be consumed as it arrives, seal it with ``AES/GCM/_STREAMSealer`` instead.
+    public typealias _Decryptor = _AEADDecryptor<AES.GCM>
+
+    /// Seals a stream as a sequence of separately authenticated AES-GCM chunks, under a key of 128, 192 or 256 bits.
+    ///
+    /// Each chunk is limited to the AES-GCM maximum message size.
+    public typealias _STREAMSealer = _AEADSTREAMSealer<AES.GCM>
+
+    /// Opens a stream sealed by ``AES/GCM/_STREAMSealer``, one chunk at a time.
+    public typealias _STREAMOpener = _AEADSTREAMOpener<AES.GCM>
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension AES.GCM: _StreamingAEAD {
+    public static var _streamingImplementation: _StreamingAEADImplementation<AES.GCM.Nonce> {
+        _StreamingAEADImplementation(
+            boringSSLAEAD: { try AES.GCM.boringSSLAEAD(for: $0) },
+            streamSubkeyInfo: Array("swift-crypto STREAM AES-GCM subkey".utf8),
+            randomNonce: { AES.GCM.Nonce() }
+        )
+    }
+}
@@ -147,9 +147,10 @@ extension P384._ARCV1 {
         public var rawRepresentation: Data {
             var result = Data(capacity: Self.serializedByteCount)
 
-            result.append(self.backing.X0.oprfRepresentation)
-            result.append(self.backing.X1.oprfRepresentation)
-            result.append(self.backing.X2.oprfRepresentation)
+            let points = [self.backing.X0, self.backing.X1, self.backing.X2]
+            for serializedPoint in H2G.G.Element.oprfRepresentations(of: points) {
+                result.append(serializedPoint)
+            }
             assert(result.count == Self.serializedByteCount)
 
             return result
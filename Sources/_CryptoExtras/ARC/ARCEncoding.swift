@@ -26,8 +26,9 @@ extension ARC.CredentialRequest where H2G == ARCH2G {
 
     func serialize() -> Data {
         var result = Data(capacity: Self.serializedByteCount)
-        result.append(self.m1Enc.compressedRepresentation)
-        result.append(self.m2Enc.compressedRepresentation)
+        for serializedPoint in H2G.G.Element.oprfRepresentations(of: [self.m1Enc, self.m2Enc]) {
+            result.append(serializedPoint)
+        }
         result.append(self.proof.serialize())
         return result
     }
@@ -55,12 +56,10 @@ extension ARC.CredentialResponse where H2G == ARCH2G {
     func serialize() -> Data {
         var result = Data(capacity: Self.serializedByteCount)
 
-        result.append(self.U.compressedRepresentation)
-        result.append(self.encUPrime.compressedRepresentation)
-        result.append(self.X0Aux.compressedRepresentation)
-        result.append(self.X1Aux.compressedRepresentation)
-        result.append(self.X2Aux.compressedRepresentation)
-        result.append(self.HAux.compressedRepresentation)
+        let points = [self.U, self.encUPrime, self.X0Aux, self.X1Aux, self.X2Aux, self.HAux]
+        for serializedPoint in H2G.G.Element.oprfRepresentations(of: points) {
+            result.append(serializedPoint)
+        }
         result.append(self.proof.serialize())
 
         return result
@@ -95,10 +94,10 @@ extension ARC.Presentation where H2G == ARCH2G {
     func serialize() -> Data {
         var result = Data(capacity: Self.serializedByteCount)
 
-        result.append(self.U.compressedRepresentation)
-        result.append(self.UPrimeCommit.compressedRepresentation)
-        result.append(self.m1Commit.compressedRepresentation)
-        result.append(self.tag.compressedRepresentation)
+        let points = [self.U, self.UPrimeCommit, self.m1Commit, self.tag]
+        for serializedPoint in H2G.G.Element.oprfRepresentations(of: points) {
+            result.append(serializedPoint)
+        }
         result.append(self.proof.serialize())
 
         return result
@@ -129,9 +128,9 @@ extension ARC.ServerPublicKey where H2G == ARCH2G {
     func serialize() -> Data {
         var result = Data(capacity: Self.serializedByteCount)
 
-        result.append(self.X0.compressedRepresentation)
-        result.append(self.X1.compressedRepresentation)
-        result.append(self.X2.compressedRepresentation)
+        for serializedPoint in H2G.G.Element.oprfRepresentations(of: [self.X0, self.X1, self.X2]) {
+            result.append(serializedPoint)
+        }
 
         return result
     }
@@ -203,11 +202,10 @@ extension ARC.Credential where H2G == ARCH2G {
         var result = Data(capacity: Self.serializedByteCountExcludingPresentationState + presentationStateBytes.count)
 
         result.append(self.m1.rawRepresentation)
-        result.append(self.U.compressedRepresentation)
-        result.append(self.UPrime.compressedRepresentation)
-        result.append(self.X1.compressedRepresentation)
-        result.append(self.generatorG.compressedRepresentation)
-        result.append(self.generatorH.compressedRepresentation)
+        let points = [self.U, self.UPrime, self.X1, self.generatorG, self.generatorH]
+        for serializedPoint in H2G.G.Element.oprfRepresentations(of: points) {
+            result.append(serializedPoint)
+        }
         result.append(presentationStateBytes)
 
         return result
@@ -60,10 +60,14 @@ extension ARC {
         init(ciphersuite: Ciphersuite<H2G>, x0: Group.Scalar = Group.Scalar.random, x1: Group.Scalar = Group.Scalar.random, x2: Group.Scalar = Group.Scalar.random, x0Blinding: Group.Scalar = Group.Scalar.random
         ) {
             self.ciphersuite = ciphersuite
-            (self.generatorG, self.generatorH) = ARC.getGenerators(suite: ciphersuite)
+            // Every issuance multiplies the generators and the public key, so precompute their multiples once here.
+            let (generatorG, generatorH) = ARC.getGenerators(suite: ciphersuite)
+            self.generatorG = generatorG.prepared()
+            self.generatorH = generatorH.prepared()
 
             self.serverPrivateKey = ServerPrivateKey(x0: x0, x1: x1, x2: x2, x0Blinding: x0Blinding)
-            self.serverPublicKey = ServerPublicKey(serverPrivateKey: self.serverPrivateKey, generatorG: self.generatorG, generatorH: self.generatorH)
+            let serverPublicKey = ServerPublicKey(serverPrivateKey: self.serverPrivateKey, generatorG: self.generatorG, generatorH: self.generatorH)
+            self.serverPublicKey = ServerPublicKey(X0: serverPublicKey.X0.prepared(), X1: serverPublicKey.X1.prepared(), X2: serverPublicKey.X2.prepared())
         }
 
         func respond(credentialRequest: CredentialRequest<H2G>, b: Group.Scalar = Group.Scalar.random) throws -> CredentialResponse<H2G> {
@@ -0,0 +1,268 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// NOTE: This file is unconditionally compiled because the keyed context is implemented using BoringSSL on all platforms.
+import Crypto
+import CryptoBoringWrapper
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension ChaChaPoly {
+    /// A ChaCha20-Poly1305 context bound to a single key.
+    ///
+    /// ``ChaChaPoly/seal(_:using:nonce:authenticating:)`` initializes a new AEAD context on every call. A keyed
+    /// context does that work once, when it is created, so that each subsequent seal or open only pays for the
+    /// per-message work. Prefer it when sealing many small messages under one long-lived key.
+    ///
+    /// A keyed context can be shared between threads.
+    @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+    public struct _KeyedContext: Sendable {
+        private let context: BoringSSLAEAD.AEADContext
+
+        /// Creates a context for the given key.
+        ///
+        /// - Parameter key: A 256-bit encryption key.
+        public init(key: SymmetricKey) throws {
+            let aead = try ChaChaPoly.boringSSLAEAD(for: key)
+            self.context = try withCryptoKitErrors {
+                try BoringSSLAEAD.AEADContext(cipher: aead, key: key, preparingForDiscontiguousInput: true)
+            }
+        }
+
+        /// Secures the given plaintext message with encryption and an authentication tag that covers both the
+        /// encrypted data and additional data.
+        ///
+        /// - Parameters:
+        ///   - message: The plaintext data to seal.
+        ///   - nonce: The nonce the sealing process requires. If you don't provide a nonce, the method generates a random one by invoking ``ChaChaPoly/Nonce/init()``.
+        ///   - authenticatedData: Additional data to be authenticated.
+        /// - Returns: The sealed message.
+        public func seal<Plaintext: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ message: Plaintext,
+            nonce: ChaChaPoly.Nonce? = nil,
+            authenticating authenticatedData: AuthenticatedData
+        ) throws -> ChaChaPoly.SealedBox {
+            let nonce = nonce ?? ChaChaPoly.Nonce()
+            let (ciphertext, tag) = try withCryptoKitErrors {
+                try self.context.seal(message: message, nonce: nonce, authenticatedData: authenticatedData)
+            }
+            return try ChaChaPoly.SealedBox(nonce: nonce, ciphertext: ciphertext, tag: tag)
+        }
+
+        /// Secures the given plaintext message with encryption and an authentication tag.
+        ///
+        /// - Parameters:
+        ///   - message: The plaintext data to seal.
+        ///   - nonce: The nonce the sealing process requires. If you don't provide a nonce, the method generates a random one by invoking ``ChaChaPoly/Nonce/init()``.
+        /// - Returns: The sealed message.
+        public func seal<Plaintext: DataProtocol>(
+            _ message: Plaintext,
+            nonce: ChaChaPoly.Nonce? = nil
+        ) throws -> ChaChaPoly.SealedBox {
+            try self.seal(message, nonce: nonce, authenticating: Data())
+        }
+
+        /// Decrypts the message and verifies the authenticity of both the encrypted message and additional data.
+        ///
+        /// - Parameters:
+        ///   - sealedBox: The sealed box to open.
+        ///   - authenticatedData: Additional data that was authenticated.
+        /// - Returns: The original plaintext message that was sealed in the box, as long as the correct key is
+        ///   used and authentication succeeds. The call throws an error if decryption or authentication fail.
+        public func open<AuthenticatedData: DataProtocol>(
+            _ sealedBox: ChaChaPoly.SealedBox,
+            authenticating authenticatedData: AuthenticatedData
+        ) throws -> Data {
+            try withCryptoKitErrors {
+                try self.context.open(
+                    ciphertext: sealedBox.ciphertext,
+                    nonce: sealedBox.nonce,
+                    tag: sealedBox.tag,
+                    authenticatedData: authenticatedData
+                )
+            }
+        }
+
+        /// Decrypts the message and verifies its authenticity.
+        ///
+        /// - Parameter sealedBox: The sealed box to open.
+        /// - Returns: The original plaintext message that was sealed in the box, as long as the correct key is
+        ///   used and authentication succeeds. The call throws an error if decryption or authentication fail.
+        public func open(_ sealedBox: ChaChaPoly.SealedBox) throws -> Data {
+            try self.open(sealedBox, authenticating: Data())
+        }
+
+        /// Seals a message into caller-provided memory, without allocating.
+        ///
+        /// The ciphertext is written to the start of `output`, immediately followed by the 16-byte tag, so `output`
+        /// must be at least `message.count + 16` bytes long. `output` may start at the same address as a contiguous
+        /// `message` to seal in place, but must not otherwise overlap it.
+        ///
+        /// - Parameters:
+        ///   - message: The plaintext data to seal.
+        ///   - nonce: The nonce the sealing process requires.
+        ///   - authenticatedData: Additional data to be authenticated.
+        ///   - output: The memory to write the ciphertext and tag to.
+        /// - Returns: The number of bytes written to `output`.
+        public func seal<Plaintext: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ message: Plaintext,
+            nonce: ChaChaPoly.Nonce,
+            authenticating authenticatedData: AuthenticatedData,
+            into output: UnsafeMutableRawBufferPointer
+        ) throws -> Int {
+            try withCryptoKitErrors {
+                try self.context.seal(
+                    message: message,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    into: output
+                )
+            }
+        }
+
+        /// Seals a message, appending the ciphertext and then the 16-byte tag to `output`.
+        ///
+        /// - Parameters:
+        ///   - message: The plaintext data to seal.
+        ///   - nonce: The nonce the sealing process requires.
+        ///   - authenticatedData: Additional data to be authenticated.
+        ///   - output: The buffer to append the ciphertext and tag to.
+        public func seal<Plaintext: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ message: Plaintext,
+            nonce: ChaChaPoly.Nonce,
+            authenticating authenticatedData: AuthenticatedData,
+            appendingTo output: inout [UInt8]
+        ) throws {
+            try withCryptoKitErrors {
+                try self.context.seal(
+                    message: message,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    appendingTo: &output
+                )
+            }
+        }
+
+        /// Seals a message, appending the ciphertext and then the 16-byte tag to `output`.
+        ///
+        /// - Parameters:
+        ///   - message: The plaintext data to seal.
+        ///   - nonce: The nonce the sealing process requires.
+        ///   - authenticatedData: Additional data to be authenticated.
+        ///   - output: The buffer to append the ciphertext and tag to.
+        public func seal<Plaintext: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ message: Plaintext,
+            nonce: ChaChaPoly.Nonce,
+            authenticating authenticatedData: AuthenticatedData,
+            appendingTo output: inout Data
+        ) throws {
+            try withCryptoKitErrors {
+                try self.context.seal(
+                    message: message,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    appendingTo: &output
+                )
+            }
+        }
+
+        /// Decrypts a message made of the ciphertext immediately followed by the 16-byte tag into caller-provided
+        /// memory, without allocating.
+        ///
+        /// `output` must be at least `ciphertextAndTag.count - 16` bytes long. It may start at the same address as
+        /// a contiguous `ciphertextAndTag` to open in place, but must not otherwise overlap it. If authentication
+        /// fails, the bytes written to `output` are zeroed before the error is thrown.
+        ///
+        /// - Parameters:
+        ///   - ciphertextAndTag: The ciphertext, followed by the tag.
+        ///   - nonce: The nonce that was used to seal the message.
+        ///   - authenticatedData: Additional data that was authenticated.
+        ///   - output: The memory to write the plaintext to.
+        /// - Returns: The number of bytes written to `output`.
+        public func open<CiphertextAndTag: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ ciphertextAndTag: CiphertextAndTag,
+            nonce: ChaChaPoly.Nonce,
+            authenticating authenticatedData: AuthenticatedData,
+            into output: UnsafeMutableRawBufferPointer
+        ) throws -> Int {
+            try withCryptoKitErrors {
+                try self.context.open(
+                    combinedCiphertextAndTag: ciphertextAndTag,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    into: output
+                )
+            }
+        }
+
+        /// Decrypts a message made of the ciphertext immediately followed by the 16-byte tag, appending the
+        /// plaintext to `output`.
+        ///
+        /// - Parameters:
+        ///   - ciphertextAndTag: The ciphertext, followed by the tag.
+        ///   - nonce: The nonce that was used to seal the message.
+        ///   - authenticatedData: Additional data that was authenticated.
+        ///   - output: The buffer to append the plaintext to.
+        public func open<CiphertextAndTag: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ ciphertextAndTag: CiphertextAndTag,
+            nonce: ChaChaPoly.Nonce,
+            authenticating authenticatedData: AuthenticatedData,
+            appendingTo output: inout [UInt8]
+        ) throws {
+            try withCryptoKitErrors {
+                try self.context.open(
+                    combinedCiphertextAndTag: ciphertextAndTag,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    appendingTo: &output
+                )
+            }
+        }
+
+        /// Decrypts a message made of the ciphertext immediately followed by the 16-byte tag, appending the
+        /// plaintext to `output`.
+        ///
+        /// - Parameters:
+        ///   - ciphertextAndTag: The ciphertext, followed by the tag.
+        ///   - nonce: The nonce that was used to seal the message.
+        ///   - authenticatedData: Additional data that was authenticated.
+        ///   - output: The buffer to append the plaintext to.
+        public func open<CiphertextAndTag: DataProtocol, AuthenticatedData: DataProtocol>(
+            _ ciphertextAndTag: CiphertextAndTag,
+            nonce: ChaChaPoly.Nonce,
+            authenticating authenticatedData: AuthenticatedData,
+            appendingTo output: inout Data
+        ) throws {
+            try withCryptoKitErrors {
+                try self.context.open(
+                    combinedCiphertextAndTag: ciphertextAndTag,
+                    nonce: nonce,
+                    authenticatedData: authenticatedData,
+                    appendingTo: &output
+                )
+            }
+        }
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension ChaChaPoly {
+    /// The BoringSSL ChaCha20-Poly1305 cipher, after checking that `key` is the right size for it.
+    static func boringSSLAEAD(for key: SymmetricKey) throws -> BoringSSLAEAD {
+        guard key.bitCount == 256 else {
+            throw CryptoKitError.incorrectKeySize
+        }
+        return .chacha20
+    }
+}
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// NOTE: This file is unconditionally compiled because streaming ChaChaPoly is implemented using BoringSSL on all platforms.
+import Crypto
+import CryptoBoringWrapper
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension ChaChaPoly {
+    /// Seals a single ChaCha20-Poly1305 message a piece at a time, under a 256-bit key.
+    ///
+    /// The ciphertext and tag are the same as the ones ``ChaChaPoly/seal(_:using:nonce:authenticating:)`` produces
+    /// for the whole message, so either can be opened with ``ChaChaPoly/_Decryptor`` or
+    /// ``ChaChaPoly/open(_:using:authenticating:)``.
+    public typealias _Encryptor = _AEADEncryptor<ChaChaPoly>
+
+    /// Opens a single ChaCha20-Poly1305 message a piece at a time.
+    ///
+    /// - Important: The plaintext is unauthenticated until the decryptor has been finalized. If the message needs to
+    ///   be consumed as it arrives, seal it with ``ChaChaPoly/_STREAMSealer`` instead.
+    public typealias _Decryptor = _AEADDecryptor<ChaChaPoly>
+
+    /// Seals a stream as a sequence of separately authenticated ChaCha20-Poly1305 chunks, under a 256-bit key.
+    ///
+    /// Each chunk is limited to the ChaCha20-Poly1305 maximum message size.
+    public typealias _STREAMSealer = _AEADSTREAMSealer<ChaChaPoly>
+
+    /// Opens a stream sealed by ``ChaChaPoly/_STREAMSealer``, one chunk at a time.
+    public typealias _STREAMOpener = _AEADSTREAMOpener<ChaChaPoly>
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension ChaChaPoly: _StreamingAEAD {
+    public static var _streamingImplementation: _StreamingAEADImplementation<ChaChaPoly.Nonce> {
+        _StreamingAEADImplementation(
+            boringSSLAEAD: { try ChaChaPoly.boringSSLAEAD(for: $0) },
+            streamSubkeyInfo: Array("swift-crypto STREAM ChaCha20-Poly1305 subkey".utf8),
+            randomNonce: { ChaChaPoly.Nonce() }
+        )
+    }
+}
@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_implementationOnly import CCryptoBoringSSLShims
+import Crypto
+import Foundation
+
+/// The shared implementation of the SHA-3 and SHAKE hash functions, backed by BoringSSL's Keccak core.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+struct BoringSSLKeccak {
+    enum Variant {
+        case sha3_256
+        case sha3_384
+        case sha3_512
+        case shake128
+        case shake256
+    }
+
+    private var context: KeccakContext
+
+    init(_ variant: Variant) {
+        self.context = KeccakContext(variant)
+    }
+
+    mutating func update(data: UnsafeRawBufferPointer) {
+        if !isKnownUniquelyReferenced(&self.context) {
+            self.context = KeccakContext(copying: self.context)
+        }
+        self.context.absorb(data)
+    }
+
+    /// Squeezes `output.count` bytes from a copy of the state, leaving this one able to absorb more data.
+    ///
+    /// For the SHA-3 variants, `output` must be exactly the digest length.
+    func finalize(into output: UnsafeMutableRawBufferPointer) {
+        KeccakContext(copying: self.context).squeeze(into: output)
+    }
+
+    /// Returns a squeezer over a copy of the state. Only valid for the SHAKE variants.
+    func makeSqueezer() -> Squeezer {
+        Squeezer(context: KeccakContext(copying: self.context))
+    }
+
+    struct Squeezer {
+        private var context: KeccakContext
+
+        fileprivate init(context: KeccakContext) {
+            self.context = context
+        }
+
+        mutating func squeeze(into output: UnsafeMutableRawBufferPointer) {
+            if !isKnownUniquelyReferenced(&self.context) {
+                self.context = KeccakContext(copying: self.context)
+            }
+            self.context.squeeze(into: output)
+        }
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+private final class KeccakContext {
+    private var state: CCryptoBoringSSLShims_keccak_st
+
+    init(_ variant: BoringSSLKeccak.Variant) {
+        self.state = CCryptoBoringSSLShims_keccak_st()
+        let shimVariant: CCryptoBoringSSLShims_keccak_variant
+        switch variant {
+        case .sha3_256:
+            shimVariant = CCryptoBoringSSLShims_keccak_sha3_256
+        case .sha3_384:
+            shimVariant = CCryptoBoringSSLShims_keccak_sha3_384
+        case .sha3_512:
+            shimVariant = CCryptoBoringSSLShims_keccak_sha3_512
+        case .shake128:
+            shimVariant = CCryptoBoringSSLShims_keccak_shake128
+        case .shake256:
+            shimVariant = CCryptoBoringSSLShims_keccak_shake256
+        }
+        CCryptoBoringSSLShims_keccak_init(&self.state, shimVariant)
+    }
+
+    init(copying original: KeccakContext) {
+        self.state = original.state
+    }
+
+    deinit {
+        withUnsafeMutableBytes(of: &self.state) { $0.initializeMemory(as: UInt8.self, repeating: 0) }
+    }
+
+    func absorb(_ data: UnsafeRawBufferPointer) {
+        guard data.count > 0 else {
+            return
+        }
+        CCryptoBoringSSLShims_keccak_absorb(&self.state, data.baseAddress, data.count)
+    }
+
+    func squeeze(into output: UnsafeMutableRawBufferPointer) {
+        CCryptoBoringSSLShims_keccak_squeeze(&self.state, output.baseAddress, output.count)
+    }
+}
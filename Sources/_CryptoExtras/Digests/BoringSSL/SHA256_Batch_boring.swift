@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_implementationOnly import CCryptoBoringSSL
+@_implementationOnly import CCryptoBoringSSLShims
+import Crypto
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+enum BoringSSLSHA256Batch {
+    static let digestByteCount = Int(SHA256_DIGEST_LENGTH)
+
+    /// The number of messages passed to BoringSSL at a time by the `DataProtocol` overload of ``hash(_:)``.
+    static let messagesPerCall = 16
+
+    static func hash(_ messages: [UnsafeRawBufferPointer], into output: UnsafeMutableRawBufferPointer) throws {
+        try messages.withUnsafeBufferPointer { try Self.hash($0, into: output) }
+    }
+
+    static func hash(
+        _ messages: UnsafeBufferPointer<UnsafeRawBufferPointer>,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws {
+        guard output.count / Self.digestByteCount >= messages.count else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+
+        withUnsafeTemporaryAllocation(of: UnsafeRawPointer?.self, capacity: messages.count) { messagePointers in
+            withUnsafeTemporaryAllocation(of: Int.self, capacity: messages.count) { messageLengths in
+                for (index, message) in messages.enumerated() {
+                    messagePointers.initializeElement(at: index, to: message.baseAddress)
+                    messageLengths.initializeElement(at: index, to: message.count)
+                }
+
+                CCryptoBoringSSLShims_SHA256_batch(
+                    messagePointers.baseAddress,
+                    messageLengths.baseAddress,
+                    messages.count,
+                    output.baseAddress
+                )
+            }
+        }
+    }
+
+    static func hash<Message: DataProtocol>(_ messages: [Message]) -> Data {
+        var digests = Data(count: messages.count * Self.digestByteCount)
+        digests.withUnsafeMutableBytes { digestBytes in
+            withUnsafeTemporaryAllocation(
+                of: UnsafeRawBufferPointer.self,
+                capacity: Self.messagesPerCall
+            ) { messageBuffers in
+                var start = 0
+                while start < messages.count {
+                    let end = min(start + Self.messagesPerCall, messages.count)
+                    let output = UnsafeMutableRawBufferPointer(
+                        rebasing: digestBytes[(start * Self.digestByteCount)..<(end * Self.digestByteCount)]
+                    )
+                    Self.withBytes(of: messages[start..<end], storingInto: messageBuffers, at: 0) { count in
+                        // The output is exactly the right size, so this can't throw.
+                        try! Self.hash(UnsafeBufferPointer(rebasing: messageBuffers[..<count]), into: output)
+                    }
+                    start = end
+                }
+            }
+        }
+        return digests
+    }
+
+    /// Stores the bytes of each of `messages` into `buffers`, starting at `index`, and then calls `body` with the
+    /// number of buffers filled. Contiguous messages are borrowed in place; only discontiguous ones are copied.
+    private static func withBytes<Messages: Collection>(
+        of messages: Messages,
+        storingInto buffers: UnsafeMutableBufferPointer<UnsafeRawBufferPointer>,
+        at index: Int,
+        _ body: (Int) -> Void
+    ) where Messages.Element: DataProtocol {
+        guard let message = messages.first else {
+            return body(index)
+        }
+
+        let remaining = messages.dropFirst()
+        if message.regions.count == 1 {
+            message.regions.first!.withUnsafeBytes { bytes in
+                buffers[index] = bytes
+                Self.withBytes(of: remaining, storingInto: buffers, at: index + 1, body)
+            }
+        } else {
+            Array(message).withUnsafeBytes { bytes in
+                buffers[index] = bytes
+                Self.withBytes(of: remaining, storingInto: buffers, at: index + 1, body)
+            }
+        }
+    }
+}
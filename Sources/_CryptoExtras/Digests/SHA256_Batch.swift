@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// NOTE: This file is unconditionally compiled because batch hashing is implemented using BoringSSL on all platforms.
+import Crypto
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension SHA256 {
+    /// Computes the SHA-256 digest of every message in a batch.
+    ///
+    /// Hashing a message with ``SHA256/hash(data:)`` sets up and tears down a hash context every time, which
+    /// dominates the cost for small messages. This hashes the whole batch in a single call into BoringSSL instead,
+    /// and so is much faster when hashing large numbers of small, independent messages, such as content-defined
+    /// chunks. Runs of consecutive messages of equal length are also hashed several at once in vector lanes: 16 at a
+    /// time with AVX-512, 8 with AVX2 and 4 with SSE2 or NEON, whenever that beats the processor's SHA-256
+    /// instructions.
+    ///
+    /// This lives in `_CryptoExtras` rather than on `Crypto`'s `SHA256`, whose API must match CryptoKit's.
+    ///
+    /// - Parameters:
+    ///   - messages: The messages to hash.
+    ///   - output: The memory to write the digests to, one after another in the order of `messages`. It must be at
+    ///     least `32 * messages.count` bytes long.
+    public static func _hash(
+        batch messages: [UnsafeRawBufferPointer],
+        into output: UnsafeMutableRawBufferPointer
+    ) throws {
+        try BoringSSLSHA256Batch.hash(messages, into: output)
+    }
+
+    /// Computes the SHA-256 digest of every message in a batch.
+    ///
+    /// Contiguous messages are hashed in place. Messages made up of several regions are copied first.
+    ///
+    /// - Parameter messages: The messages to hash.
+    /// - Returns: The digests of `messages`, one after another. The digest of `messages[i]` is the 32 bytes starting
+    ///   at offset `32 * i`.
+    public static func _hash<Message: DataProtocol>(batch messages: [Message]) -> Data {
+        BoringSSLSHA256Batch.hash(messages)
+    }
+}
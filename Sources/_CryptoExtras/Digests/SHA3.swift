@@ -0,0 +1,253 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+
+/// An implementation of Secure Hashing Algorithm 3 (SHA-3) hashing with a 256-bit digest, as specified in FIPS 202.
+///
+/// This is backed by the Keccak permutation that BoringSSL also uses for ML-KEM and ML-DSA.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHA3_256: HashFunction {
+    /// The number of bytes that represents the hash function's internal state.
+    public static var blockByteCount: Int {
+        136
+    }
+
+    /// The number of bytes in a SHA3-256 digest.
+    public static var byteCount: Int {
+        32
+    }
+
+    /// The digest type for a SHA3-256 hash function.
+    public typealias Digest = SHA3_256Digest
+
+    var impl: BoringSSLKeccak
+
+    /// Creates a SHA3-256 hash function.
+    public init() {
+        self.impl = BoringSSLKeccak(.sha3_256)
+    }
+
+    /// Incrementally updates the hash function with the contents of the buffer.
+    ///
+    /// - Parameters:
+    ///   - bufferPointer: A pointer to the next block of data for the ongoing digest calculation.
+    public mutating func update(bufferPointer: UnsafeRawBufferPointer) {
+        self.impl.update(data: bufferPointer)
+    }
+
+    /// Finalizes the hash function and returns the computed digest.
+    ///
+    /// - Returns: The computed digest of the data.
+    public func finalize() -> SHA3_256Digest {
+        SHA3_256Digest(self.impl)
+    }
+}
+
+/// An implementation of Secure Hashing Algorithm 3 (SHA-3) hashing with a 384-bit digest, as specified in FIPS 202.
+///
+/// This is backed by the Keccak permutation that BoringSSL also uses for ML-KEM and ML-DSA.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHA3_384: HashFunction {
+    /// The number of bytes that represents the hash function's internal state.
+    public static var blockByteCount: Int {
+        104
+    }
+
+    /// The number of bytes in a SHA3-384 digest.
+    public static var byteCount: Int {
+        48
+    }
+
+    /// The digest type for a SHA3-384 hash function.
+    public typealias Digest = SHA3_384Digest
+
+    var impl: BoringSSLKeccak
+
+    /// Creates a SHA3-384 hash function.
+    public init() {
+        self.impl = BoringSSLKeccak(.sha3_384)
+    }
+
+    /// Incrementally updates the hash function with the contents of the buffer.
+    ///
+    /// - Parameters:
+    ///   - bufferPointer: A pointer to the next block of data for the ongoing digest calculation.
+    public mutating func update(bufferPointer: UnsafeRawBufferPointer) {
+        self.impl.update(data: bufferPointer)
+    }
+
+    /// Finalizes the hash function and returns the computed digest.
+    ///
+    /// - Returns: The computed digest of the data.
+    public func finalize() -> SHA3_384Digest {
+        SHA3_384Digest(self.impl)
+    }
+}
+
+/// An implementation of Secure Hashing Algorithm 3 (SHA-3) hashing with a 512-bit digest, as specified in FIPS 202.
+///
+/// This is backed by the Keccak permutation that BoringSSL also uses for ML-KEM and ML-DSA.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHA3_512: HashFunction {
+    /// The number of bytes that represents the hash function's internal state.
+    public static var blockByteCount: Int {
+        72
+    }
+
+    /// The number of bytes in a SHA3-512 digest.
+    public static var byteCount: Int {
+        64
+    }
+
+    /// The digest type for a SHA3-512 hash function.
+    public typealias Digest = SHA3_512Digest
+
+    var impl: BoringSSLKeccak
+
+    /// Creates a SHA3-512 hash function.
+    public init() {
+        self.impl = BoringSSLKeccak(.sha3_512)
+    }
+
+    /// Incrementally updates the hash function with the contents of the buffer.
+    ///
+    /// - Parameters:
+    ///   - bufferPointer: A pointer to the next block of data for the ongoing digest calculation.
+    public mutating func update(bufferPointer: UnsafeRawBufferPointer) {
+        self.impl.update(data: bufferPointer)
+    }
+
+    /// Finalizes the hash function and returns the computed digest.
+    ///
+    /// - Returns: The computed digest of the data.
+    public func finalize() -> SHA3_512Digest {
+        SHA3_512Digest(self.impl)
+    }
+}
+
+/// The output of a Secure Hashing Algorithm 3 (SHA-3) hash with a 256-bit digest.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHA3_256Digest: Digest {
+    let bytes: (UInt64, UInt64, UInt64, UInt64)
+
+    fileprivate init(_ hasher: BoringSSLKeccak) {
+        var bytes = (UInt64(0), UInt64(0), UInt64(0), UInt64(0))
+        withUnsafeMutableBytes(of: &bytes) { hasher.finalize(into: $0) }
+        self.bytes = bytes
+    }
+
+    /// The number of bytes in the digest.
+    public static var byteCount: Int {
+        32
+    }
+
+    /// Invokes the given closure with a buffer pointer covering the raw bytes of the digest.
+    ///
+    /// - Parameters:
+    ///   - body: A closure that takes a raw buffer pointer to the bytes of the digest and returns the digest.
+    ///
+    /// - Returns: The digest, as returned from the body closure.
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try Swift.withUnsafeBytes(of: self.bytes, body)
+    }
+
+    /// Hashes the essential components of the digest by feeding them into the given hash function.
+    ///
+    /// Don't confuse that hashing with the cryptographically secure hashing that you use to create the digest in the
+    /// first place by, for example, calling ``SHA3_256/hash(data:)``.
+    ///
+    /// - Parameters:
+    ///   - hasher: The hash function to use when combining the components of the digest.
+    public func hash(into hasher: inout Hasher) {
+        self.withUnsafeBytes { hasher.combine(bytes: $0) }
+    }
+}
+
+/// The output of a Secure Hashing Algorithm 3 (SHA-3) hash with a 384-bit digest.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHA3_384Digest: Digest {
+    let bytes: (UInt64, UInt64, UInt64, UInt64, UInt64, UInt64)
+
+    fileprivate init(_ hasher: BoringSSLKeccak) {
+        var bytes = (UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0))
+        withUnsafeMutableBytes(of: &bytes) { hasher.finalize(into: $0) }
+        self.bytes = bytes
+    }
+
+    /// The number of bytes in the digest.
+    public static var byteCount: Int {
+        48
+    }
+
+    /// Invokes the given closure with a buffer pointer covering the raw bytes of the digest.
+    ///
+    /// - Parameters:
+    ///   - body: A closure that takes a raw buffer pointer to the bytes of the digest and returns the digest.
+    ///
+    /// - Returns: The digest, as returned from the body closure.
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try Swift.withUnsafeBytes(of: self.bytes, body)
+    }
+
+    /// Hashes the essential components of the digest by feeding them into the given hash function.
+    ///
+    /// Don't confuse that hashing with the cryptographically secure hashing that you use to create the digest in the
+    /// first place by, for example, calling ``SHA3_384/hash(data:)``.
+    ///
+    /// - Parameters:
+    ///   - hasher: The hash function to use when combining the components of the digest.
+    public func hash(into hasher: inout Hasher) {
+        self.withUnsafeBytes { hasher.combine(bytes: $0) }
+    }
+}
+
+/// The output of a Secure Hashing Algorithm 3 (SHA-3) hash with a 512-bit digest.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHA3_512Digest: Digest {
+    let bytes: (UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64)
+
+    fileprivate init(_ hasher: BoringSSLKeccak) {
+        var bytes = (UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0))
+        withUnsafeMutableBytes(of: &bytes) { hasher.finalize(into: $0) }
+        self.bytes = bytes
+    }
+
+    /// The number of bytes in the digest.
+    public static var byteCount: Int {
+        64
+    }
+
+    /// Invokes the given closure with a buffer pointer covering the raw bytes of the digest.
+    ///
+    /// - Parameters:
+    ///   - body: A closure that takes a raw buffer pointer to the bytes of the digest and returns the digest.
+    ///
+    /// - Returns: The digest, as returned from the body closure.
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try Swift.withUnsafeBytes(of: self.bytes, body)
+    }
+
+    /// Hashes the essential components of the digest by feeding them into the given hash function.
+    ///
+    /// Don't confuse that hashing with the cryptographically secure hashing that you use to create the digest in the
+    /// first place by, for example, calling ``SHA3_512/hash(data:)``.
+    ///
+    /// - Parameters:
+    ///   - hasher: The hash function to use when combining the components of the digest.
+    public func hash(into hasher: inout Hasher) {
+        self.withUnsafeBytes { hasher.combine(bytes: $0) }
+    }
+}
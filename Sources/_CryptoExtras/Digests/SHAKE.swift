@@ -0,0 +1,318 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+
+/// An implementation of the SHAKE128 extendable-output function, as specified in FIPS 202.
+///
+/// As a ``HashFunction``, ``SHAKE128`` produces a 256-bit digest, which gives the function's full 128-bit
+/// security level. Use ``finalize(outputByteCount:)`` or ``makeSqueezer()`` for output of any other length.
+///
+/// This is backed by the Keccak permutation that BoringSSL also uses for ML-KEM and ML-DSA.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHAKE128: HashFunction {
+    /// The number of bytes that represents the hash function's internal state.
+    public static var blockByteCount: Int {
+        168
+    }
+
+    /// The number of bytes in a SHAKE128 digest, which is twice the security level.
+    public static var byteCount: Int {
+        32
+    }
+
+    /// The digest type for a SHAKE128 hash function.
+    public typealias Digest = SHAKE128Digest
+
+    var impl: BoringSSLKeccak
+
+    /// Creates a SHAKE128 hash function.
+    public init() {
+        self.impl = BoringSSLKeccak(.shake128)
+    }
+
+    /// Incrementally updates the hash function with the contents of the buffer.
+    ///
+    /// - Parameters:
+    ///   - bufferPointer: A pointer to the next block of data for the ongoing digest calculation.
+    public mutating func update(bufferPointer: UnsafeRawBufferPointer) {
+        self.impl.update(data: bufferPointer)
+    }
+
+    /// Finalizes the hash function and returns the computed digest.
+    ///
+    /// - Returns: The computed digest of the data.
+    public func finalize() -> SHAKE128Digest {
+        SHAKE128Digest(self.impl)
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension SHAKE128 {
+    /// Computes `outputByteCount` bytes of SHAKE128 output for the bytes in the given data instance.
+    ///
+    /// - Parameters:
+    ///   - data: The data to hash.
+    ///   - outputByteCount: The number of bytes of output to produce.
+    ///
+    /// - Returns: The output of the function.
+    public static func hash<D: DataProtocol>(data: D, outputByteCount: Int) -> Data {
+        var hasher = Self()
+        hasher.update(data: data)
+        return hasher.finalize(outputByteCount: outputByteCount)
+    }
+
+    /// Finalizes the function and returns `outputByteCount` bytes of output.
+    ///
+    /// Shorter outputs are prefixes of longer ones, so don't use outputs of different lengths for the same data where
+    /// they need to be independent.
+    ///
+    /// - Parameter outputByteCount: The number of bytes of output to produce.
+    /// - Returns: The output of the function.
+    public func finalize(outputByteCount: Int) -> Data {
+        precondition(outputByteCount >= 0, "outputByteCount must not be negative")
+        var squeezer = self.makeSqueezer()
+        return squeezer.squeeze(outputByteCount: outputByteCount)
+    }
+
+    /// Finalizes the function and returns a squeezer that reads its output incrementally.
+    ///
+    /// The hash function itself is not affected, so you can continue to update it afterwards.
+    public func makeSqueezer() -> Squeezer {
+        Squeezer(self.impl.makeSqueezer())
+    }
+
+    /// Reads the output of a finalized ``SHAKE128`` function incrementally.
+    ///
+    /// Successive calls continue the output where the previous one stopped, so reading it in pieces produces the same
+    /// bytes as reading it all at once.
+    public struct Squeezer {
+        private var impl: BoringSSLKeccak.Squeezer
+
+        fileprivate init(_ impl: BoringSSLKeccak.Squeezer) {
+            self.impl = impl
+        }
+
+        /// Fills `output` with the next bytes of output.
+        ///
+        /// - Parameter output: The memory to write the output to.
+        public mutating func squeeze(into output: UnsafeMutableRawBufferPointer) {
+            guard output.count > 0 else {
+                return
+            }
+            self.impl.squeeze(into: output)
+        }
+
+        /// Returns the next `outputByteCount` bytes of output.
+        ///
+        /// - Parameter outputByteCount: The number of bytes of output to produce.
+        /// - Returns: The output.
+        public mutating func squeeze(outputByteCount: Int) -> Data {
+            precondition(outputByteCount >= 0, "outputByteCount must not be negative")
+            var output = Data(count: outputByteCount)
+            output.withUnsafeMutableBytes { self.squeeze(into: $0) }
+            return output
+        }
+    }
+}
+
+/// An implementation of the SHAKE256 extendable-output function, as specified in FIPS 202.
+///
+/// As a ``HashFunction``, ``SHAKE256`` produces a 512-bit digest, which gives the function's full 256-bit
+/// security level. Use ``finalize(outputByteCount:)`` or ``makeSqueezer()`` for output of any other length.
+///
+/// This is backed by the Keccak permutation that BoringSSL also uses for ML-KEM and ML-DSA.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHAKE256: HashFunction {
+    /// The number of bytes that represents the hash function's internal state.
+    public static var blockByteCount: Int {
+        136
+    }
+
+    /// The number of bytes in a SHAKE256 digest, which is twice the security level.
+    public static var byteCount: Int {
+        64
+    }
+
+    /// The digest type for a SHAKE256 hash function.
+    public typealias Digest = SHAKE256Digest
+
+    var impl: BoringSSLKeccak
+
+    /// Creates a SHAKE256 hash function.
+    public init() {
+        self.impl = BoringSSLKeccak(.shake256)
+    }
+
+    /// Incrementally updates the hash function with the contents of the buffer.
+    ///
+    /// - Parameters:
+    ///   - bufferPointer: A pointer to the next block of data for the ongoing digest calculation.
+    public mutating func update(bufferPointer: UnsafeRawBufferPointer) {
+        self.impl.update(data: bufferPointer)
+    }
+
+    /// Finalizes the hash function and returns the computed digest.
+    ///
+    /// - Returns: The computed digest of the data.
+    public func finalize() -> SHAKE256Digest {
+        SHAKE256Digest(self.impl)
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension SHAKE256 {
+    /// Computes `outputByteCount` bytes of SHAKE256 output for the bytes in the given data instance.
+    ///
+    /// - Parameters:
+    ///   - data: The data to hash.
+    ///   - outputByteCount: The number of bytes of output to produce.
+    ///
+    /// - Returns: The output of the function.
+    public static func hash<D: DataProtocol>(data: D, outputByteCount: Int) -> Data {
+        var hasher = Self()
+        hasher.update(data: data)
+        return hasher.finalize(outputByteCount: outputByteCount)
+    }
+
+    /// Finalizes the function and returns `outputByteCount` bytes of output.
+    ///
+    /// Shorter outputs are prefixes of longer ones, so don't use outputs of different lengths for the same data where
+    /// they need to be independent.
+    ///
+    /// - Parameter outputByteCount: The number of bytes of output to produce.
+    /// - Returns: The output of the function.
+    public func finalize(outputByteCount: Int) -> Data {
+        precondition(outputByteCount >= 0, "outputByteCount must not be negative")
+        var squeezer = self.makeSqueezer()
+        return squeezer.squeeze(outputByteCount: outputByteCount)
+    }
+
+    /// Finalizes the function and returns a squeezer that reads its output incrementally.
+    ///
+    /// The hash function itself is not affected, so you can continue to update it afterwards.
+    public func makeSqueezer() -> Squeezer {
+        Squeezer(self.impl.makeSqueezer())
+    }
+
+    /// Reads the output of a finalized ``SHAKE256`` function incrementally.
+    ///
+    /// Successive calls continue the output where the previous one stopped, so reading it in pieces produces the same
+    /// bytes as reading it all at once.
+    public struct Squeezer {
+        private var impl: BoringSSLKeccak.Squeezer
+
+        fileprivate init(_ impl: BoringSSLKeccak.Squeezer) {
+            self.impl = impl
+        }
+
+        /// Fills `output` with the next bytes of output.
+        ///
+        /// - Parameter output: The memory to write the output to.
+        public mutating func squeeze(into output: UnsafeMutableRawBufferPointer) {
+            guard output.count > 0 else {
+                return
+            }
+            self.impl.squeeze(into: output)
+        }
+
+        /// Returns the next `outputByteCount` bytes of output.
+        ///
+        /// - Parameter outputByteCount: The number of bytes of output to produce.
+        /// - Returns: The output.
+        public mutating func squeeze(outputByteCount: Int) -> Data {
+            precondition(outputByteCount >= 0, "outputByteCount must not be negative")
+            var output = Data(count: outputByteCount)
+            output.withUnsafeMutableBytes { self.squeeze(into: $0) }
+            return output
+        }
+    }
+}
+
+/// The output of the SHAKE128 extendable-output function with a 256-bit digest.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHAKE128Digest: Digest {
+    let bytes: (UInt64, UInt64, UInt64, UInt64)
+
+    fileprivate init(_ hasher: BoringSSLKeccak) {
+        var bytes = (UInt64(0), UInt64(0), UInt64(0), UInt64(0))
+        withUnsafeMutableBytes(of: &bytes) { hasher.finalize(into: $0) }
+        self.bytes = bytes
+    }
+
+    /// The number of bytes in the digest.
+    public static var byteCount: Int {
+        32
+    }
+
+    /// Invokes the given closure with a buffer pointer covering the raw bytes of the digest.
+    ///
+    /// - Parameters:
+    ///   - body: A closure that takes a raw buffer pointer to the bytes of the digest and returns the digest.
+    ///
+    /// - Returns: The digest, as returned from the body closure.
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try Swift.withUnsafeBytes(of: self.bytes, body)
+    }
+
+    /// Hashes the essential components of the digest by feeding them into the given hash function.
+    ///
+    /// Don't confuse that hashing with the cryptographically secure hashing that you use to create the digest in the
+    /// first place by, for example, calling ``SHAKE128/hash(data:)``.
+    ///
+    /// - Parameters:
+    ///   - hasher: The hash function to use when combining the components of the digest.
+    public func hash(into hasher: inout Hasher) {
+        self.withUnsafeBytes { hasher.combine(bytes: $0) }
+    }
+}
+
+/// The output of the SHAKE256 extendable-output function with a 512-bit digest.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct SHAKE256Digest: Digest {
+    let bytes: (UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64)
+
+    fileprivate init(_ hasher: BoringSSLKeccak) {
+        var bytes = (UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0), UInt64(0))
+        withUnsafeMutableBytes(of: &bytes) { hasher.finalize(into: $0) }
+        self.bytes = bytes
+    }
+
+    /// The number of bytes in the digest.
+    public static var byteCount: Int {
+        64
+    }
+
+    /// Invokes the given closure with a buffer pointer covering the raw bytes of the digest.
+    ///
+    /// - Parameters:
+    ///   - body: A closure that takes a raw buffer pointer to the bytes of the digest and returns the digest.
+    ///
+    /// - Returns: The digest, as returned from the body closure.
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try Swift.withUnsafeBytes(of: self.bytes, body)
+    }
+
+    /// Hashes the essential components of the digest by feeding them into the given hash function.
+    ///
+    /// Don't confuse that hashing with the cryptographically secure hashing that you use to create the digest in the
+    /// first place by, for example, calling ``SHAKE256/hash(data:)``.
+    ///
+    /// - Parameters:
+    ///   - hasher: The hash function to use when combining the components of the digest.
+    public func hash(into hasher: inout Hasher) {
+        self.withUnsafeBytes { hasher.combine(bytes: $0) }
+    }
+}
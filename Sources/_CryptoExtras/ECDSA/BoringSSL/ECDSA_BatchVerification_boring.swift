@@ -0,0 +1,151 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_implementationOnly import CCryptoBoringSSL
+@_implementationOnly import CCryptoBoringSSLShims
+import Crypto
+import Foundation
+
+#if canImport(Dispatch)
+import Dispatch
+#endif
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+enum BoringSSLECDSABatchVerification {
+    /// The fewest signatures worth handing to another thread. Each one takes tens of microseconds to verify, so this
+    /// keeps the cost of dispatching well below the work dispatched.
+    static let minimumSignaturesPerThread = 64
+
+    static func areValidSignatures<Message: DataProtocol>(
+        _ batch: [(signature: P256.Signing.ECDSASignature, data: Message, publicKey: P256.Signing.PublicKey)]
+    ) -> [Bool] {
+        // Each distinct key is parsed once, and its signatures are verified consecutively so that BoringSSL can share
+        // a table of the key's multiples between them.
+        var keys: [OpaquePointer?] = []
+        defer {
+            for key in keys {
+                CCryptoBoringSSL_EC_KEY_free(key)
+            }
+        }
+        var keyIndices: [Data: Int] = [:]
+        let itemKeys = batch.map { item -> Int in
+            let x963Representation = item.publicKey.x963Representation
+            if let keyIndex = keyIndices[x963Representation] {
+                return keyIndex
+            }
+            keys.append(Self.makeKey(x963Representation: x963Representation))
+            keyIndices[x963Representation] = keys.count - 1
+            return keys.count - 1
+        }
+        let order = batch.indices.filter { keys[itemKeys[$0]] != nil }.sorted {
+            (itemKeys[$0], $0) < (itemKeys[$1], $1)
+        }
+
+        var results = [Bool](repeating: false, count: batch.count)
+        guard order.count > 0 else {
+            return results
+        }
+
+        // Every signature is the same length, so each item gets a fixed slot for its digest and signature.
+        let digestByteCount = SHA256.byteCount
+        let slotByteCount = digestByteCount + batch[order[0]].signature.rawRepresentation.count
+        let scratch = UnsafeMutableRawBufferPointer.allocate(byteCount: order.count * slotByteCount, alignment: 16)
+        defer { scratch.deallocate() }
+
+        var valid = [UInt8](repeating: 0, count: order.count)
+        withUnsafeTemporaryAllocation(of: UnsafeRawPointer?.self, capacity: 2 * order.count) { pointers in
+            withUnsafeTemporaryAllocation(of: Int.self, capacity: 2 * order.count) { lengths in
+                withUnsafeTemporaryAllocation(of: OpaquePointer?.self, capacity: order.count) { itemKeyPointers in
+                    valid.withUnsafeMutableBufferPointer { validPointer in
+                        // Hashing is done here too, so that it is spread across threads along with verification.
+                        func verify(_ positions: Range<Int>) {
+                            for position in positions {
+                                let item = batch[order[position]]
+                                let slot = scratch.baseAddress! + position * slotByteCount
+                                SHA256.hash(data: item.data).withUnsafeBytes { digest in
+                                    UnsafeMutableRawBufferPointer(start: slot, count: digestByteCount)
+                                        .copyMemory(from: digest)
+                                }
+                                let signature = item.signature.rawRepresentation
+                                signature.copyBytes(
+                                    to: UnsafeMutableRawBufferPointer(
+                                        start: slot + digestByteCount,
+                                        count: slotByteCount - digestByteCount
+                                    )
+                                )
+
+                                pointers.initializeElement(at: position, to: UnsafeRawPointer(slot))
+                                pointers.initializeElement(
+                                    at: order.count + position,
+                                    to: UnsafeRawPointer(slot + digestByteCount)
+                                )
+                                lengths.initializeElement(at: position, to: digestByteCount)
+                                lengths.initializeElement(at: order.count + position, to: signature.count)
+                                itemKeyPointers.initializeElement(
+                                    at: position,
+                                    to: keys[itemKeys[order[position]]]
+                                )
+                            }
+
+                            _ = CCryptoBoringSSLShims_ECDSA_verify_p1363_batch(
+                                validPointer.baseAddress! + positions.lowerBound,
+                                pointers.baseAddress! + positions.lowerBound,
+                                lengths.baseAddress! + positions.lowerBound,
+                                pointers.baseAddress! + order.count + positions.lowerBound,
+                                lengths.baseAddress! + order.count + positions.lowerBound,
+                                itemKeyPointers.baseAddress! + positions.lowerBound,
+                                positions.count
+                            )
+                        }
+
+                        #if canImport(Dispatch)
+                        let threadCount = min(
+                            ProcessInfo.processInfo.activeProcessorCount,
+                            order.count / Self.minimumSignaturesPerThread
+                        )
+                        if threadCount > 1 {
+                            DispatchQueue.concurrentPerform(iterations: threadCount) { thread in
+                                let start = order.count * thread / threadCount
+                                let end = order.count * (thread + 1) / threadCount
+                                verify(start..<end)
+                            }
+                            return
+                        }
+                        #endif
+                        verify(0..<order.count)
+                    }
+                }
+            }
+        }
+
+        for (position, index) in order.enumerated() {
+            results[index] = valid[position] != 0
+        }
+        return results
+    }
+
+    private static func makeKey(x963Representation: Data) -> OpaquePointer? {
+        guard let key = CCryptoBoringSSL_EC_KEY_new_by_curve_name(NID_X9_62_prime256v1) else {
+            return nil
+        }
+        let parsed = x963Representation.withUnsafeBytes { bytes in
+            CCryptoBoringSSL_EC_KEY_oct2key(key, bytes.baseAddress, bytes.count, nil)
+        }
+        guard parsed == 1 else {
+            CCryptoBoringSSL_EC_KEY_free(key)
+            return nil
+        }
+        return key
+    }
+}
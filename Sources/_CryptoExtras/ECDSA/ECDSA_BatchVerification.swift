@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// NOTE: This file is unconditionally compiled because batch verification is implemented using BoringSSL on all
+// platforms.
+import Crypto
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension P256.Signing.PublicKey {
+    /// Verifies a batch of ECDSA signatures over P-256, each of the SHA-256 digest of its data.
+    ///
+    /// This accepts exactly the signatures that ``isValidSignature(_:for:)`` accepts, but shares work across the
+    /// batch. The signatures' inversions are combined into one, and signatures by the same key share a table of
+    /// that key's multiples, which makes each of them about three times cheaper to check once a key has signed six
+    /// or more signatures in the batch. Large batches are also spread across the available processors.
+    ///
+    /// - Parameter batch: The signatures to verify, each with the data it signs and the key that signed it.
+    /// - Returns: Whether each signature in `batch` is valid, in the same order.
+    public static func _areValidSignatures<Message: DataProtocol>(
+        _ batch: [(signature: P256.Signing.ECDSASignature, data: Message, publicKey: P256.Signing.PublicKey)]
+    ) -> [Bool] {
+        BoringSSLECDSABatchVerification.areValidSignatures(batch)
+    }
+}
@@ -11,6 +11,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 //===----------------------------------------------------------------------===//
+@_implementationOnly import CCryptoBoringSSLShims
 import Crypto
 import CryptoBoringWrapper
 import Foundation
@@ -39,9 +40,6 @@ protocol OpenSSLSupportedNISTCurve {
     // TODO: could this be moved to the group or to the HashFunction?
     @inlinable
     static var hashToFieldByteCount: Int { get }
-
-    @inlinable
-    static var __ffac: FiniteFieldArithmeticContext { get }
 }
 
 /// NOTE: This conformance applies to this type from the Crypto module even if it comes from the SDK.
@@ -64,11 +62,6 @@ extension P256: OpenSSLSupportedNISTCurve {
 
     @inlinable
     static var hashToFieldByteCount: Int { 48 }
-
-    @TaskLocal
-    @usableFromInline
-    // NOTE: This could be a let when Swift 6.0 is the minimum supported version.
-    static var __ffac = try! FiniteFieldArithmeticContext(fieldSize: P256.group.order)
 }
 
 /// NOTE: This conformance applies to this type from the Crypto module even if it comes from the SDK.
@@ -91,11 +84,6 @@ extension P384: OpenSSLSupportedNISTCurve {
 
     @inlinable
     static var hashToFieldByteCount: Int { 72 }
-
-    @TaskLocal
-    @usableFromInline
-    // NOTE: This could be a let when Swift 6.0 is the minimum supported version.
-    static var __ffac = try! FiniteFieldArithmeticContext(fieldSize: P384.group.order)
 }
 
 /// NOTE: This conformance applies to this type from the Crypto module even if it comes from the SDK.
@@ -118,19 +106,18 @@ extension P521: OpenSSLSupportedNISTCurve {
 
     @inlinable
     static var hashToFieldByteCount: Int { 98 }
-
-    @TaskLocal
-    @usableFromInline
-    // NOTE: This could be a let when Swift 6.0 is the minimum supported version.
-    static var __ffac = try! FiniteFieldArithmeticContext(fieldSize: P521.group.order)
 }
 
+/// A scalar modulo the order of the group, stored inline in Montgomery form.
+///
+/// Unlike `ArbitraryPrecisionInteger`, which wraps a heap-allocated `BIGNUM`, this makes scalar arithmetic
+/// allocation-free.
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 struct OpenSSLGroupScalar<C: OpenSSLSupportedNISTCurve>: GroupScalar, CustomStringConvertible {
-    var openSSLScalar: ArbitraryPrecisionInteger
+    private var scalar: CCryptoBoringSSLShims_ec_scalar
 
-    init(_ openSSLScalar: ArbitraryPrecisionInteger) {
-        self.openSSLScalar = openSSLScalar
+    private init(_ scalar: CCryptoBoringSSLShims_ec_scalar) {
+        self.scalar = scalar
     }
 
     /// Deserializes a scalar from data.
@@ -140,67 +127,157 @@ struct OpenSSLGroupScalar<C: OpenSSLSupportedNISTCurve>: GroupScalar, CustomStri
     /// - Returns: The deserialized scalar
     init(bytes: Data, reductionIsModOrder: Bool = false) throws {
         if reductionIsModOrder {
-            self.init(
-                try ArbitraryPrecisionInteger(bytes: bytes).modulo(C.group.weierstrassCoefficients.field)
-            )
-        } else {
-            self.init(try C.__ffac.residue(ArbitraryPrecisionInteger(bytes: bytes)))
+            let reduced = try ArbitraryPrecisionInteger(bytes: bytes).modulo(C.group.weierstrassCoefficients.field)
+            try self.init(bytes: Data(bytesOf: reduced, paddedToSize: C.group.coordinateByteCount))
+            return
         }
+
+        var scalar = CCryptoBoringSSLShims_ec_scalar()
+        let success = bytes.withUnsafeBytes { bytesPointer in
+            C.group.withUnsafeGroupPointer { group in
+                CCryptoBoringSSLShims_ec_scalar_from_bytes(group, &scalar, bytesPointer.baseAddress, bytesPointer.count)
+            }
+        }
+        guard success == 1 else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+        self.init(scalar)
+    }
+
+    /// The scalar itself, for the point multiplication shims, which take it without converting it to a `BIGNUM`.
+    fileprivate var ecScalar: CCryptoBoringSSLShims_ec_scalar {
+        self.scalar
     }
 
     static var random: Self {
-        // Force-try: Protocol requires non-throwing and this can only throw if bounds are invalid.
-        try! Self(.random(inclusiveMin: 0, exclusiveMax: C.group.order))
+        var scalar = CCryptoBoringSSLShims_ec_scalar()
+        let success = C.group.withUnsafeGroupPointer { group in
+            CCryptoBoringSSLShims_ec_scalar_random(group, &scalar)
+        }
+        // Protocol requires non-throwing and this can only fail if the system RNG does.
+        precondition(success == 1, "Unable to generate a random scalar")
+        return Self(scalar)
     }
 
     static func + (left: Self, right: Self) -> Self {
-        // Force-try: Protocol requires non-throwing and this can only throw if modulus is invalid.
-        try! Self(C.__ffac.add(left.openSSLScalar, right.openSSLScalar))
-
+        Self.binaryOperation(left, right, CCryptoBoringSSLShims_ec_scalar_add)
     }
 
     static func - (left: Self, right: Self) -> Self {
-        // Force-try: Protocol requires non-throwing and this can only throw if modulus is invalid.
-        try! Self(C.__ffac.subtract(right.openSSLScalar, from: left.openSSLScalar))
+        Self.binaryOperation(left, right, CCryptoBoringSSLShims_ec_scalar_sub)
     }
 
     static func ^ (left: Self, right: Int) -> Self {
         precondition(right == -1, "Unimplemented arbitrary exponentiation")
-        // Force-try: Protocol requires non-throwing and this can only throw if modulus is invalid.
-        return try! Self(C.__ffac.inverse(left.openSSLScalar)!)
+        precondition(!left.isZero, "Zero has no inverse")
+        return Self.unaryOperation(left, CCryptoBoringSSLShims_ec_scalar_inv0)
     }
 
     static func * (left: Self, right: Self) -> Self {
-        // Force-try: Protocol requires non-throwing and this can only throw if modulus is invalid.
-        try! Self(C.__ffac.multiply(left.openSSLScalar, right.openSSLScalar))
+        Self.binaryOperation(left, right, CCryptoBoringSSLShims_ec_scalar_mul)
     }
 
     static prefix func - (left: Self) -> Self {
-        // Force-try: Protocol requires non-throwing and this can only throw if modulus is invalid.
-        try! Self(C.__ffac.subtract(left.openSSLScalar, from: ArbitraryPrecisionInteger.zero))
+        Self.unaryOperation(left, CCryptoBoringSSLShims_ec_scalar_neg)
     }
 
     static func == (left: Self, right: Self) -> Bool {
-        left.openSSLScalar == right.openSSLScalar
+        withUnsafePointer(to: left.scalar) { leftPointer in
+            withUnsafePointer(to: right.scalar) { rightPointer in
+                C.group.withUnsafeGroupPointer { group in
+                    CCryptoBoringSSLShims_ec_scalar_equal(group, leftPointer, rightPointer) == 1
+                }
+            }
+        }
+    }
+
+    private var isZero: Bool {
+        withUnsafePointer(to: self.scalar) { scalarPointer in
+            C.group.withUnsafeGroupPointer { group in
+                CCryptoBoringSSLShims_ec_scalar_is_zero(group, scalarPointer) == 1
+            }
+        }
     }
 
     var rawRepresentation: Data {
-        // Force-try: This can only throw if the requested size is not big enough to represent the point.
-        try! Data(bytesOf: self.openSSLScalar, paddedToSize: C.orderByteCount)
+        var bytes = Data(count: C.orderByteCount)
+        bytes.withUnsafeMutableBytes { bytesPointer in
+            withUnsafePointer(to: self.scalar) { scalarPointer in
+                C.group.withUnsafeGroupPointer { group in
+                    var length = 0
+                    CCryptoBoringSSLShims_ec_scalar_to_bytes(group, bytesPointer.baseAddress, &length, scalarPointer)
+                    precondition(length == C.orderByteCount)
+                }
+            }
+        }
+        return bytes
     }
 
     var description: String {
         self.rawRepresentation.hexString
     }
+
+    private static func unaryOperation(
+        _ operand: Self,
+        _ operation: (
+            OpaquePointer?,
+            UnsafeMutablePointer<CCryptoBoringSSLShims_ec_scalar>?,
+            UnsafePointer<CCryptoBoringSSLShims_ec_scalar>?
+        ) -> Void
+    ) -> Self {
+        var result = CCryptoBoringSSLShims_ec_scalar()
+        withUnsafePointer(to: operand.scalar) { operandPointer in
+            C.group.withUnsafeGroupPointer { group in
+                operation(group, &result, operandPointer)
+            }
+        }
+        return Self(result)
+    }
+
+    private static func binaryOperation(
+        _ left: Self,
+        _ right: Self,
+        _ operation: (
+            OpaquePointer?,
+            UnsafeMutablePointer<CCryptoBoringSSLShims_ec_scalar>?,
+            UnsafePointer<CCryptoBoringSSLShims_ec_scalar>?,
+            UnsafePointer<CCryptoBoringSSLShims_ec_scalar>?
+        ) -> Void
+    ) -> Self {
+        var result = CCryptoBoringSSLShims_ec_scalar()
+        withUnsafePointer(to: left.scalar) { leftPointer in
+            withUnsafePointer(to: right.scalar) { rightPointer in
+                C.group.withUnsafeGroupPointer { group in
+                    operation(group, &result, leftPointer, rightPointer)
+                }
+            }
+        }
+        return Self(result)
+    }
 }
 
+/// A point on the curve.
+///
+/// The point operations pass no `BN_CTX`: BoringSSL only uses one to reduce out-of-range scalars, and ours are always
+/// reduced. That leaves no shared mutable state, so points can be used from any number of threads at once.
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 struct OpenSSLCurvePoint<C: OpenSSLSupportedNISTCurve>: GroupElement {
     var ecPoint: EllipticCurvePoint
     typealias Scalar = OpenSSLGroupScalar<C>
 
+    /// The precomputed multiples of `ecPoint`, if this point has been prepared.
+    private var preparedPoint: PreparedEllipticCurvePoint?
+
     init(ecPoint: EllipticCurvePoint) {
         self.ecPoint = ecPoint
+        self.preparedPoint = nil
+    }
+
+    func prepared() -> Self {
+        var prepared = self
+        // The point at infinity can't be prepared, and doesn't need to be.
+        prepared.preparedPoint = try? PreparedEllipticCurvePoint(self.ecPoint, on: C.group)
+        return prepared
     }
 
     static var generator: Self {
@@ -217,44 +294,103 @@ struct OpenSSLCurvePoint<C: OpenSSLSupportedNISTCurve>: GroupElement {
 
     static func + (left: consuming Self, right: consuming Self) -> Self {
         // Force-try: Protocol requires non-throwing.
-        try! Self(ecPoint: left.ecPoint.adding(right.ecPoint, on: C.group, context: C.__ffac))
+        try! Self(ecPoint: left.ecPoint.adding(right.ecPoint, on: C.group))
     }
 
     static func - (left: consuming Self, right: consuming Self) -> Self {
         // Force-try: Protocol requires non-throwing.
-        try! Self(ecPoint: left.ecPoint.subtracting(right.ecPoint, on: C.group, context: C.__ffac))
+        try! Self(ecPoint: left.ecPoint.subtracting(right.ecPoint, on: C.group))
     }
 
     static prefix func - (left: Self) -> Self {
         // Force-try: Protocol requires non-throwing.
-        try! Self(ecPoint: left.ecPoint.inverting(on: C.group, context: C.__ffac))
+        try! Self(ecPoint: left.ecPoint.inverting(on: C.group))
     }
 
     static func * (left: consuming Scalar, right: consuming Self) -> Self {
         // Force-try: Protocol requires non-throwing.
-        try! Self(ecPoint: right.ecPoint.multiplying(by: left.openSSLScalar, on: C.group, context: C.__ffac))
+        let result = try! EllipticCurvePoint(_pointAtInfinityOn: C.group)
+        let success = withUnsafePointer(to: left.ecScalar) { scalarPointer in
+            C.group.withUnsafeGroupPointer { group in
+                result.withPointPointer { resultPointer in
+                    if let preparedPoint = right.preparedPoint {
+                        return preparedPoint.withUnsafePrecompPointer { precompPointer in
+                            CCryptoBoringSSLShims_EC_POINT_mul_precomp_ec_scalar(
+                                group,
+                                resultPointer,
+                                precompPointer,
+                                scalarPointer
+                            )
+                        }
+                    }
+                    return right.ecPoint.withPointPointer { pointPointer in
+                        CCryptoBoringSSLShims_EC_POINT_mul_ec_scalar(group, resultPointer, pointPointer, scalarPointer)
+                    }
+                }
+            }
+        }
+        // The scalars are always reduced, so this can only fail if allocation does.
+        precondition(success == 1, "Unable to multiply a point")
+        return Self(ecPoint: result)
+    }
+
+    static func publicMultiScalarMultiplication(_ terms: [(scalar: Scalar, element: Self)]) -> Self {
+        // Force-try: Protocol requires non-throwing.
+        let result = try! EllipticCurvePoint(_pointAtInfinityOn: C.group)
+        // The point pointers stay valid for as long as `terms` keeps the points alive.
+        let success = withExtendedLifetime(terms) {
+            withUnsafeTemporaryAllocation(of: OpaquePointer?.self, capacity: terms.count) { points in
+                withUnsafeTemporaryAllocation(
+                    of: CCryptoBoringSSLShims_ec_scalar.self,
+                    capacity: terms.count
+                ) { scalars in
+                    for (index, term) in terms.enumerated() {
+                        points.initializeElement(at: index, to: term.element.ecPoint.withPointPointer { $0 })
+                        scalars.initializeElement(at: index, to: term.scalar.ecScalar)
+                    }
+                    return C.group.withUnsafeGroupPointer { group in
+                        result.withPointPointer { resultPointer in
+                            CCryptoBoringSSLShims_EC_POINT_mul_public_batch_ec_scalars(
+                                group,
+                                resultPointer,
+                                points.baseAddress,
+                                scalars.baseAddress,
+                                terms.count
+                            )
+                        }
+                    }
+                }
+            }
+        }
+        precondition(success == 1, "Unable to compute a multi-scalar multiplication")
+        return Self(ecPoint: result)
     }
 
     static func == (left: Self, right: Self) -> Bool {
-        left.ecPoint.isEqual(to: right.ecPoint, on: C.group, context: C.__ffac)
+        left.ecPoint.isEqual(to: right.ecPoint, on: C.group)
     }
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension OpenSSLCurvePoint {
     var compressedRepresentation: Data {
-        try! self.ecPoint.x962Representation(compressed: true, on: C.group, context: C.__ffac)
+        try! self.ecPoint.x962Representation(compressed: true, on: C.group)
     }
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension OpenSSLCurvePoint: OPRFGroupElement {
     init(oprfRepresentation data: Data) throws {
-        let point = try EllipticCurvePoint(x962Representation: data, on: C.group, context: C.__ffac)
+        let point = try EllipticCurvePoint(x962Representation: data, on: C.group)
         self.init(ecPoint: point)
     }
 
     var oprfRepresentation: Data { self.compressedRepresentation }
+
+    static func oprfRepresentations(of elements: [Self]) -> [Data] {
+        // Force-try: Protocol requires non-throwing.
+        try! EllipticCurvePoint.x962Representations(of: elements.map { $0.ecPoint }, compressed: true, on: C.group)
+    }
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
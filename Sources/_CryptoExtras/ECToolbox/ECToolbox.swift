@@ -92,6 +92,27 @@ protocol GroupElement {
 
     // Group Point Multiplication
     static func * (left: Scalar, right: Self) -> Self
+
+    // Variable-time sum of scalar * element over the terms, for public inputs only
+    static func publicMultiScalarMultiplication(_ terms: [(scalar: Scalar, element: Self)]) -> Self
+
+    // Returns an equal element that caches tables to speed up multiplying it, for elements multiplied many times
+    func prepared() -> Self
+
     // Constant-time Comparison
     static func == (left: Self, right: Self) -> Bool
 }
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension GroupElement {
+    static func publicMultiScalarMultiplication(_ terms: [(scalar: Scalar, element: Self)]) -> Self {
+        precondition(!terms.isEmpty, "A multi-scalar multiplication needs at least one term")
+        return terms.dropFirst().reduce(terms[0].scalar * terms[0].element) { sum, term in
+            sum + term.scalar * term.element
+        }
+    }
+
+    func prepared() -> Self {
+        self
+    }
+}
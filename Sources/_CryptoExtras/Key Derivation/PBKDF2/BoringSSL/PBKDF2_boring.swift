@@ -11,12 +11,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 //===----------------------------------------------------------------------===//
-import Crypto
-import Foundation
 
-#if !canImport(CommonCrypto)
+// NOTE: This file is unconditionally compiled because batch derivation is implemented using BoringSSL on all
+// platforms. Single keys are derived with CommonCrypto where it is available.
 @_implementationOnly import CCryptoBoringSSL
 @_implementationOnly import CCryptoBoringSSLShims
+import Crypto
+import Foundation
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 internal struct BoringSSLPBKDF2 {
@@ -64,6 +65,88 @@ internal struct BoringSSLPBKDF2 {
 
         return SymmetricKey(data: derivedKeyData)
     }
+
+    /// Derives a key from each of a batch of passphrases and salts.
+    ///
+    /// - Parameters:
+    ///    - batch: The passphrases and the salts to use with them.
+    ///    - hashFunction: The hash function to use for key derivation.
+    ///    - outputByteCount: The length in bytes of each resulting symmetric key.
+    ///    - rounds: The number of rounds which should be used to perform key derivation.
+    /// - Returns: The derived symmetric keys, in the same order as `batch`.
+    static func deriveKeys<Passphrase: DataProtocol, Salt: DataProtocol>(
+        from batch: [(password: Passphrase, salt: Salt)],
+        using hashFunction: KDF.Insecure.PBKDF2.HashFunction,
+        outputByteCount: Int,
+        rounds: Int
+    ) throws -> [SymmetricKey] {
+        let (totalByteCount, overflow) = batch.count.multipliedReportingOverflow(by: outputByteCount)
+        guard !overflow else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+
+        // The passphrases and salts are each gathered into one buffer, which BoringSSL is given pointers into.
+        var passwords: [UInt8] = []
+        var passwordLengths: [Int] = []
+        var salts: [UInt8] = []
+        var saltLengths: [Int] = []
+        passwordLengths.reserveCapacity(batch.count)
+        saltLengths.reserveCapacity(batch.count)
+        for (password, salt) in batch {
+            passwords.append(contentsOf: password)
+            passwordLengths.append(password.count)
+            salts.append(contentsOf: salt)
+            saltLengths.append(salt.count)
+        }
+
+        // This should be SecureBytes, but we can't use that here.
+        var derivedKeysData = Data(count: totalByteCount)
+
+        let rc = derivedKeysData.withUnsafeMutableBytes { derivedKeysBytes -> Int32 in
+            passwords.withUnsafeBytes { passwordsBytes -> Int32 in
+                salts.withUnsafeBytes { saltsBytes -> Int32 in
+                    var passwordPointers: [UnsafePointer<CChar>?] = []
+                    var saltPointers: [UnsafePointer<UInt8>?] = []
+                    passwordPointers.reserveCapacity(batch.count)
+                    saltPointers.reserveCapacity(batch.count)
+                    var passwordOffset = 0
+                    var saltOffset = 0
+                    for index in batch.indices {
+                        passwordPointers.append(
+                            passwordsBytes.baseAddress.map {
+                                ($0 + passwordOffset).assumingMemoryBound(to: CChar.self)
+                            }
+                        )
+                        saltPointers.append(
+                            saltsBytes.baseAddress.map { ($0 + saltOffset).assumingMemoryBound(to: UInt8.self) }
+                        )
+                        passwordOffset += passwordLengths[index]
+                        saltOffset += saltLengths[index]
+                    }
+
+                    return CCryptoBoringSSL_PKCS5_PBKDF2_HMAC_batch(
+                        passwordPointers,
+                        passwordLengths,
+                        saltPointers,
+                        saltLengths,
+                        batch.count,
+                        UInt32(rounds),
+                        hashFunction.digest,
+                        outputByteCount,
+                        derivedKeysBytes.baseAddress
+                    )
+                }
+            }
+        }
+
+        guard rc == 1 else {
+            throw CryptoKitError.internalBoringSSLError()
+        }
+
+        return batch.indices.map { index in
+            SymmetricKey(data: derivedKeysData[(index * outputByteCount)..<((index + 1) * outputByteCount)])
+        }
+    }
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
@@ -87,5 +170,3 @@ extension KDF.Insecure.PBKDF2.HashFunction {
         }
     }
 }
-
-#endif
@@ -58,7 +58,40 @@ extension KDF.Insecure {
         public static func deriveKey<Passphrase: DataProtocol, Salt: DataProtocol>(from password: Passphrase, salt: Salt, using hashFunction: HashFunction, outputByteCount: Int, unsafeUncheckedRounds: Int) throws -> SymmetricKey {
             return try BackingPBKDF2.deriveKey(from: password, salt: salt, using: hashFunction, outputByteCount: outputByteCount, rounds: unsafeUncheckedRounds)
         }
-        
+
+        /// Derives a symmetric key from each of a batch of passphrases using the PBKDF2 algorithm.
+        ///
+        /// This derives the same keys as calling ``deriveKey(from:salt:using:outputByteCount:rounds:)`` for each passphrase in turn. With SHA-256, on processors without SHA-256 instructions, four keys are derived at once in SIMD lanes, so batches of a multiple of four passphrases are the most efficient.
+        ///
+        /// - Parameters:
+        ///    - batch: The passphrases, each with the salt to use with it.
+        ///    - hashFunction: The hash function to use for key derivation.
+        ///    - outputByteCount: The length in bytes of each resulting symmetric key.
+        ///    - rounds: The number of rounds which should be used to perform key derivation. The minimum allowed number of rounds is 210,000.
+        /// - Throws: An error if the number of rounds is less than 210,000
+        /// - Returns: The derived symmetric keys, in the same order as `batch`.
+        public static func _deriveKeys<Passphrase: DataProtocol, Salt: DataProtocol>(from batch: [(password: Passphrase, salt: Salt)], using hashFunction: HashFunction, outputByteCount: Int, rounds: Int) throws -> [SymmetricKey] {
+            guard rounds >= 210_000 else {
+                throw CryptoKitError.incorrectParameterSize
+            }
+            return try PBKDF2._deriveKeys(from: batch, using: hashFunction, outputByteCount: outputByteCount, unsafeUncheckedRounds: rounds)
+        }
+
+        /// Derives a symmetric key from each of a batch of passphrases using the PBKDF2 algorithm.
+        ///
+        /// This derives the same keys as calling ``deriveKey(from:salt:using:outputByteCount:unsafeUncheckedRounds:)`` for each passphrase in turn.
+        ///
+        /// - Parameters:
+        ///    - batch: The passphrases, each with the salt to use with it.
+        ///    - hashFunction: The hash function to use for key derivation.
+        ///    - outputByteCount: The length in bytes of each resulting symmetric key.
+        ///    - unsafeUncheckedRounds: The number of rounds which should be used to perform key derivation.
+        /// - Warning: This method allows the use of parameters which may result in insecure keys. It is important to ensure that the used parameters do not compromise the security of the application.
+        /// - Returns: The derived symmetric keys, in the same order as `batch`.
+        public static func _deriveKeys<Passphrase: DataProtocol, Salt: DataProtocol>(from batch: [(password: Passphrase, salt: Salt)], using hashFunction: HashFunction, outputByteCount: Int, unsafeUncheckedRounds: Int) throws -> [SymmetricKey] {
+            return try BoringSSLPBKDF2.deriveKeys(from: batch, using: hashFunction, outputByteCount: outputByteCount, rounds: unsafeUncheckedRounds)
+        }
+
         public struct HashFunction: Equatable, Hashable, Sendable {
             let rawValue: String
             
@@ -21,6 +21,10 @@ import Foundation
 import Android
 #endif
 
+#if canImport(Dispatch)
+import Dispatch
+#endif
+
 #if os(Windows)
 import WinSDK
 
@@ -94,4 +98,128 @@ internal struct BoringSSLScrypt {
 
         return SymmetricKey(data: derivedKeyData)
     }
+
+    /// Derives a secure key as `deriveKey` does, processing the independent blocks on up to `maxThreadCount` threads.
+    ///
+    /// - Parameters:
+    ///    - password: The passphrase, which should be used as a basis for the key.
+    ///    - salt: The salt to use for key derivation.
+    ///    - outputByteCount: The length in bytes of resulting symmetric key.
+    ///    - rounds: The number of rounds which should be used to perform key derivation. Must be a power of 2.
+    ///    - blockSize: The block size to be used by the algorithm.
+    ///    - parallelism: The number of independent blocks to process.
+    ///    - maxMemory: The maximum amount of memory to use. This bounds the number of blocks processed at once.
+    ///    - maxThreadCount: The maximum number of threads to process blocks on.
+    /// - Returns: The derived symmetric key.
+    static func deriveKey<Passphrase: DataProtocol, Salt: DataProtocol>(
+        from password: Passphrase,
+        salt: Salt,
+        outputByteCount: Int,
+        rounds: Int,
+        blockSize: Int,
+        parallelism: Int,
+        maxMemory: Int?,
+        maxThreadCount: Int
+    ) throws -> SymmetricKey {
+        // Each block is processed with its own 128 * rounds * blockSize bytes of scratch space, on top of the
+        // 128 * blockSize * parallelism bytes that hold the blocks themselves. Anything that doesn't fit is left to
+        // the sequential implementation, which also reports any invalid parameters.
+        var threadCount = min(maxThreadCount, parallelism)
+        #if canImport(Dispatch)
+        threadCount = min(threadCount, ProcessInfo.processInfo.activeProcessorCount)
+        #else
+        threadCount = 1
+        #endif
+        let (blockByteCount, blockOverflow) = 128.multipliedReportingOverflow(by: blockSize)
+        let (blocksByteCount, blocksOverflow) = blockByteCount.multipliedReportingOverflow(by: parallelism)
+        let (scratchByteCount, scratchOverflow) = blockByteCount.multipliedReportingOverflow(by: rounds &+ 2)
+        if blockSize <= 0 || rounds <= 0 || blockOverflow || blocksOverflow || scratchOverflow
+            || parallelism > ((1 << 30) - 1) / blockSize
+        {
+            threadCount = 1
+        } else if let maxMemory = maxMemory {
+            let availableByteCount = maxMemory > blocksByteCount ? maxMemory - blocksByteCount : 0
+            threadCount = min(threadCount, availableByteCount / scratchByteCount)
+        }
+        guard threadCount > 1 else {
+            return try Self.deriveKey(
+                from: password,
+                salt: salt,
+                outputByteCount: outputByteCount,
+                rounds: rounds,
+                blockSize: blockSize,
+                parallelism: parallelism,
+                maxMemory: maxMemory
+            )
+        }
+
+        // This should be SecureBytes, but we can't use that here.
+        var derivedKeyData = Data(count: outputByteCount)
+        let blocks = UnsafeMutableRawBufferPointer.allocate(byteCount: blocksByteCount, alignment: 16)
+        defer {
+            CCryptoBoringSSL_OPENSSL_cleanse(blocks.baseAddress, blocks.count)
+            blocks.deallocate()
+        }
+        var results = [Int32](repeating: 0, count: parallelism)
+
+        let result = derivedKeyData.withUnsafeMutableBytes { derivedKeyBytes -> Int32 in
+            let saltBytes: ContiguousBytes = salt.regions.count == 1 ? salt.regions.first! : Array(salt)
+            return saltBytes.withUnsafeBytes { saltBytes -> Int32 in
+                let passwordBytes: ContiguousBytes =
+                    password.regions.count == 1 ? password.regions.first! : Array(password)
+                return passwordBytes.withUnsafeBytes { passwordBytes -> Int32 in
+                    guard
+                        CCryptoBoringSSL_PKCS5_PBKDF2_HMAC(
+                            passwordBytes.baseAddress!,
+                            passwordBytes.count,
+                            saltBytes.baseAddress!,
+                            saltBytes.count,
+                            1,
+                            CCryptoBoringSSL_EVP_sha256(),
+                            blocks.count,
+                            blocks.baseAddress!
+                        ) == 1
+                    else {
+                        return 0
+                    }
+
+                    #if canImport(Dispatch)
+                    results.withUnsafeMutableBufferPointer { results in
+                        // Each thread takes every threadCount-th block, and records the result for each block it
+                        // processes.
+                        DispatchQueue.concurrentPerform(iterations: threadCount) { thread in
+                            for block in stride(from: thread, to: parallelism, by: threadCount) {
+                                results[block] = CCryptoBoringSSL_EVP_PBE_scrypt_romix(
+                                    blocks.baseAddress! + block * blockByteCount,
+                                    UInt64(rounds),
+                                    UInt64(blockSize)
+                                )
+                            }
+                        }
+                    }
+                    #endif
+                    guard results.allSatisfy({ $0 == 1 }) else {
+                        return 0
+                    }
+
+                    return CCryptoBoringSSL_PKCS5_PBKDF2_HMAC(
+                        passwordBytes.baseAddress!,
+                        passwordBytes.count,
+                        blocks.baseAddress!,
+                        blocks.count,
+                        1,
+                        CCryptoBoringSSL_EVP_sha256(),
+                        derivedKeyBytes.count,
+                        derivedKeyBytes.baseAddress!
+                    )
+                }
+            }
+        }
+
+        guard result == 1 else {
+            throw CryptoKitError.internalBoringSSLError()
+        }
+
+        return SymmetricKey(data: derivedKeyData)
+    }
 }
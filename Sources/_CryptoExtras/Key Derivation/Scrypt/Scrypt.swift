@@ -36,5 +36,27 @@ extension KDF {
         public static func deriveKey<Passphrase: DataProtocol, Salt: DataProtocol>(from password: Passphrase, salt: Salt, outputByteCount: Int, rounds: Int, blockSize: Int, parallelism: Int, maxMemory: Int? = nil) throws -> SymmetricKey {
             return try BackingScrypt.deriveKey(from: password, salt: salt, outputByteCount: outputByteCount, rounds: rounds, blockSize: blockSize, parallelism: parallelism)
         }
+
+        /// Derives a symmetric key using the scrypt algorithm, spreading the work across up to `maxThreadCount` threads.
+        ///
+        /// scrypt derives `parallelism` independent blocks from the password and salt, and this processes them
+        /// concurrently. The derived key is identical to the one `deriveKey(from:salt:outputByteCount:rounds:blockSize:parallelism:maxMemory:)`
+        /// returns. Each block processed at once needs `128 * rounds * blockSize` bytes of memory of its own, so fewer
+        /// threads are used if `maxMemory` can't accommodate `maxThreadCount` of them, and the key is derived on the
+        /// calling thread alone if it can only accommodate one.
+        ///
+        /// - Parameters:
+        ///    - password: The passphrase, which should be used as a basis for the key. This can be any type that conforms to `DataProtocol`, like `Data` or an array of `UInt8` instances.
+        ///    - salt: The salt to use for key derivation.
+        ///    - outputByteCount: The length in bytes of resulting symmetric key.
+        ///    - rounds: The number of rounds which should be used to perform key derivation. Must be a power of 2 less than `2^(128 * blockSize / 8)`.
+        ///    - blockSize: The block size to use for key derivation.
+        ///    - parallelism: The parallelism factor to use for key derivation. Must be a positive integer less than or equal to `((2^32 - 1) * 32) / (128 * blockSize)`.
+        ///    - maxMemory: The maximum amount of memory allowed to use for key derivation. If not provided, the memory needed to process `maxThreadCount` blocks at once is allowed.
+        ///    - maxThreadCount: The maximum number of threads to use. No more than `parallelism` threads, or the number of active processors, are used.
+        /// - Returns: The derived symmetric key.
+        public static func _deriveKey<Passphrase: DataProtocol, Salt: DataProtocol>(from password: Passphrase, salt: Salt, outputByteCount: Int, rounds: Int, blockSize: Int, parallelism: Int, maxMemory: Int? = nil, maxThreadCount: Int) throws -> SymmetricKey {
+            return try BackingScrypt.deriveKey(from: password, salt: salt, outputByteCount: outputByteCount, rounds: rounds, blockSize: blockSize, parallelism: parallelism, maxMemory: maxMemory, maxThreadCount: maxThreadCount)
+        }
     }
 }
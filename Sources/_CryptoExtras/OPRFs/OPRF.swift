@@ -26,6 +26,7 @@ extension OPRF {
         case incorrectProofSize
         case invalidModeForInfo
         case incompatibleMode
+        case incorrectBatchSize
     }
 }
 
@@ -34,6 +35,16 @@ extension OPRF {
 protocol OPRFGroupElement: GroupElement {
     init(oprfRepresentation: Data) throws
     var oprfRepresentation: Data { get }
+
+    // The OPRF representations of several elements at once, which can share work across them
+    static func oprfRepresentations(of elements: [Self]) -> [Data]
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension OPRFGroupElement {
+    static func oprfRepresentations(of elements: [Self]) -> [Data] {
+        elements.map { $0.oprfRepresentation }
+    }
 }
 
 @available(macOS 10.15, iOS 13.2, tvOS 13.2, watchOS 6.1, macCatalyst 13.2, visionOS 1.2, *)
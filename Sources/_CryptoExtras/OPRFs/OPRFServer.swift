@@ -22,6 +22,9 @@ extension OPRF {
         let ciphersuite: Ciphersuite<H2G>
         let privateKey: G.Scalar
         let v8CompatibilityMode: Bool
+        /// The generator, prepared once because every proof multiplies it.
+        let generator: G.Element
+        let publicKey: G.Element
         
         init(ciphersuite: Ciphersuite<H2G>, privateKey: G.Scalar = G.Scalar.random) {
             self.init(mode: .base, ciphersuite: ciphersuite, privateKey: privateKey)
@@ -32,29 +35,36 @@ extension OPRF {
             self.ciphersuite = ciphersuite
             self.privateKey = privateKey
             self.v8CompatibilityMode = v8CompatibilityMode
-        }
-        
-        var publicKey: G.Element {
-            privateKey * G.Element.generator
+            self.generator = G.Element.generator.prepared()
+            self.publicKey = privateKey * self.generator
         }
         
         func evaluate(blindedElement: G.Element, info: Data? = nil, proofScalar: G.Scalar = G.Scalar.random) throws ->
         (G.Element, DLEQProof<H2G.G.Element.Scalar>?) {
+            let (evaluatedElements, proof) = try evaluate(blindedElements: [blindedElement], info: info, proofScalar: proofScalar)
+            return (evaluatedElements[0], proof)
+        }
+        
+        /// Evaluates a batch of blinded elements under the same key and info, proving all of them with one DLEQ proof over
+        /// their composite. For a single element this is identical to `evaluate(blindedElement:info:proofScalar:)`.
+        func evaluate(blindedElements: [G.Element], info: Data? = nil, proofScalar: G.Scalar = G.Scalar.random) throws ->
+        ([G.Element], DLEQProof<H2G.G.Element.Scalar>?) {
+            precondition(!blindedElements.isEmpty)
             let dst = setupContext(mode: mode, suite: ciphersuite, v8CompatibilityMode: self.v8CompatibilityMode)
             
-            if v8CompatibilityMode { return try v8Evaluate(blindedElement: blindedElement, info: info, proofScalar: proofScalar) }
+            if v8CompatibilityMode { return try v8Evaluate(blindedElements: blindedElements, info: info, proofScalar: proofScalar) }
             
             if mode == .base || mode == .verifiable {
-                let evaluatedElement = self.privateKey * blindedElement
-                if mode == .base { return (evaluatedElement, nil) }
+                let evaluatedElements = blindedElements.map { self.privateKey * $0 }
+                if mode == .base { return (evaluatedElements, nil) }
                 
                 let proof = try DLEQ<H2G>.proveEquivalenceBetween(k: self.privateKey,
-                                                                  A: G.Element.generator,
-                                                                  B: (self.privateKey * G.Element.generator),
-                                                                  CDs: [(C: blindedElement, D: evaluatedElement)],
+                                                                  A: self.generator,
+                                                                  B: self.publicKey,
+                                                                  CDs: zip(blindedElements, evaluatedElements).map { (C: $0, D: $1) },
                                                                   dst: dst,
                                                                   proofScalar: proofScalar, v8CompatibilityMode: self.v8CompatibilityMode)
-                return (evaluatedElement, proof)
+                return (evaluatedElements, proof)
             }
             
             precondition(mode == .partiallyOblivious)
@@ -63,18 +73,19 @@ extension OPRF {
             let m = try H2G.hashToScalar(framedInfo, domainSeparationString: dst)
             let t = privateKey + m
             
-            let evaluatedElement = (t ^ (-1)) * blindedElement
+            let tInverse = t ^ (-1)
+            let evaluatedElements = blindedElements.map { tInverse * $0 }
             let proof = try DLEQ<H2G>.proveEquivalenceBetween(k: t,
-                                                              A: G.Element.generator,
-                                                              B: (t * G.Element.generator),
-                                                              CDs: [(C: evaluatedElement, D: blindedElement)],
+                                                              A: self.generator,
+                                                              B: (t * self.generator),
+                                                              CDs: zip(evaluatedElements, blindedElements).map { (C: $0, D: $1) },
                                                               dst: dst,
                                                               proofScalar: proofScalar, v8CompatibilityMode: self.v8CompatibilityMode)
-            return (evaluatedElement, proof)
+            return (evaluatedElements, proof)
         }
         
-        internal func v8Evaluate(blindedElement: G.Element, info: Data? = nil, proofScalar: G.Scalar = G.Scalar.random) throws ->
-        (G.Element, DLEQProof<H2G.G.Element.Scalar>?) {
+        internal func v8Evaluate(blindedElements: [G.Element], info: Data? = nil, proofScalar: G.Scalar = G.Scalar.random) throws ->
+        ([G.Element], DLEQProof<H2G.G.Element.Scalar>?) {
             precondition(self.mode == .verifiable || self.mode == .base)
             let setupCtx = setupContext(mode: mode, suite: ciphersuite, v8CompatibilityMode: self.v8CompatibilityMode)
             let contextDST = "Context-".data(using: .utf8)! + setupCtx
@@ -83,19 +94,20 @@ extension OPRF {
             
             let m = try H2G.hashToScalar(ctx, domainSeparationString: setupCtx)
             let t = privateKey + m
-            let evaluatedElement = (t ^ (-1)) * blindedElement
+            let tInverse = t ^ (-1)
+            let evaluatedElements = blindedElements.map { tInverse * $0 }
             
             guard self.mode != .base else {
-                return (evaluatedElement, nil)
+                return (evaluatedElements, nil)
             }
             
             let proof = try DLEQ<H2G>.proveEquivalenceBetween(k: t,
-                                                              A: G.Element.generator,
-                                                              B: (t * G.Element.generator),
-                                                              CDs: [(C: evaluatedElement, D: blindedElement)],
+                                                              A: self.generator,
+                                                              B: (t * self.generator),
+                                                              CDs: zip(evaluatedElements, blindedElements).map { (C: $0, D: $1) },
                                                               dst: setupCtx,
                                                               proofScalar: proofScalar, v8CompatibilityMode: self.v8CompatibilityMode)
-            return (evaluatedElement, proof)
+            return (evaluatedElements, proof)
         }
         
         internal func verifyFinalize(msg: Data,
@@ -358,6 +358,72 @@ extension P384._VOPRF {
             return result
         }
     }
+
+    /// The result of blind evaluation of a batch: the evaluated elements and a single proof covering all of them.
+    ///
+    /// Servers should not create values of this type manually; they are created and returned by the batch evaluate
+    /// operation.
+    ///
+    /// Clients should reconstruct values of this type from the serialized batch blind evaluation bytes sent by the
+    /// server.
+    public struct BatchBlindEvaluation {
+        /// The evaluated elements, in the same order as the blinded elements they were evaluated from.
+        public private(set) var evaluatedElements: [EvaluatedElement]
+
+        /// The proof.
+        public private(set) var proof: Proof
+
+        fileprivate init(evaluatedElements: [EvaluatedElement], proof: Proof) {
+            self.evaluatedElements = evaluatedElements
+            self.proof = proof
+        }
+
+        /// Construct a batch blind evaluation from its serialized representation.
+        ///
+        /// Servers should not create values of this type manually; they are created and returned by the batch
+        /// evaluate operation.
+        ///
+        /// Clients should reconstruct values of this type from the serialized batch blind evaluation bytes sent by the
+        /// server.
+        public init<D: DataProtocol>(rawRepresentation: D) throws {
+            let elementsByteCount = rawRepresentation.count - Proof.serializedByteCount
+            guard elementsByteCount > 0, elementsByteCount % EvaluatedElement.serializedByteCount == 0 else {
+                throw CryptoKitError.incorrectParameterSize
+            }
+
+            var remainingBytes = rawRepresentation[...]
+
+            var evaluatedElements: [EvaluatedElement] = []
+            evaluatedElements.reserveCapacity(elementsByteCount / EvaluatedElement.serializedByteCount)
+            for _ in 0..<(elementsByteCount / EvaluatedElement.serializedByteCount) {
+                let evaluatedElementBytes = remainingBytes.prefix(EvaluatedElement.serializedByteCount)
+                remainingBytes = remainingBytes.dropFirst(EvaluatedElement.serializedByteCount)
+                evaluatedElements.append(try EvaluatedElement(oprfRepresentation: evaluatedElementBytes))
+            }
+
+            let proofBytes = remainingBytes.prefix(Proof.serializedByteCount)
+            remainingBytes = remainingBytes.dropFirst(Proof.serializedByteCount)
+
+            precondition(remainingBytes.isEmpty)
+
+            let proof = try Proof(rawRepresentation: proofBytes)
+            self.init(evaluatedElements: evaluatedElements, proof: proof)
+        }
+
+        /// A serialized representation of the batch blind evaluation to send to the client: the evaluated elements
+        /// followed by the proof.
+        public var rawRepresentation: Data {
+            var result = Data(
+                capacity: self.evaluatedElements.count * EvaluatedElement.serializedByteCount
+                    + Proof.serializedByteCount
+            )
+            for evaluatedElement in self.evaluatedElements {
+                result.append(evaluatedElement.oprfRepresentation)
+            }
+            result.append(self.proof.rawRepresentation)
+            return result
+        }
+    }
 }
 
 @available(iOS 16.0, macOS 13.0, watchOS 9.0, tvOS 16.0, macCatalyst 16.0, visionOS 2.0, *)
@@ -399,6 +465,33 @@ extension P384._VOPRF.PublicKey {
             publicKey: self.backingPoint
         )
     }
+
+    /// Compute the outputs of the VOPRF for a batch of inputs by verifying the single server proof covering the batch,
+    /// and unblinding and hashing each evaluated element.
+    ///
+    /// - Parameter blindedInputs: The blinded inputs from the blind operation, in the order they were sent to the
+    /// server.
+    /// - Parameter batchBlindEvaluation: The batch blind evaluation from the batch evaluate operation, received from
+    /// the server.
+    /// - Returns: The PRF outputs, in the same order as the blinded inputs.
+    ///
+    /// - Seealso: [RFC 9497: VOPRF Protocol](https://www.rfc-editor.org/rfc/rfc9497.html#name-voprf-protocol).
+    public func finalize(
+        batch blindedInputs: [P384._VOPRF.BlindedInput],
+        using batchBlindEvaluation: P384._VOPRF.BatchBlindEvaluation
+    ) throws -> [Data] {
+        guard blindedInputs.count == batchBlindEvaluation.evaluatedElements.count else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+        return try Self.client.finalize(
+            messages: blindedInputs.map { $0.input },
+            info: nil,
+            blinds: blindedInputs.map { $0.blind.backing },
+            evaluatedElements: batchBlindEvaluation.evaluatedElements.map { $0.backing },
+            proof: batchBlindEvaluation.proof.backing,
+            publicKey: self.backingPoint
+        )
+    }
 }
 
 @available(iOS 16.0, macOS 13.0, watchOS 9.0, tvOS 16.0, macCatalyst 16.0, visionOS 2.0, *)
@@ -425,6 +518,36 @@ extension P384._VOPRF.PrivateKey {
         try self.evaluate(blindedElement, using: .random)
     }
 
+    internal func evaluate(
+        batch blindedElements: [P384._VOPRF.BlindedElement],
+        using fixedProofScalar: P384._VOPRF.H2G.G.Scalar
+    ) throws -> P384._VOPRF.BatchBlindEvaluation {
+        guard !blindedElements.isEmpty else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+        let (evaluatedElements, proof) = try self.server.evaluate(
+            blindedElements: blindedElements.map { $0.backing },
+            proofScalar: fixedProofScalar
+        )
+        return P384._VOPRF.BatchBlindEvaluation(
+            evaluatedElements: evaluatedElements.map { P384._VOPRF.EvaluatedElement(backing: $0) },
+            proof: P384._VOPRF.Proof(backing: proof)
+        )
+    }
+
+    /// Compute the evaluated elements for a batch of blinded elements, with a single proof covering all of them.
+    ///
+    /// This is cheaper than evaluating each blinded element separately, because the proof is generated once for the
+    /// whole batch.
+    ///
+    /// - Parameter blindedElements: The blinded elements from the blind operation, received from the client.
+    /// - Returns: The batch blind evaluation to be sent to the client.
+    ///
+    /// - Seealso: [RFC 9497: VOPRF Protocol](https://www.rfc-editor.org/rfc/rfc9497.html#name-voprf-protocol).
+    public func evaluate(batch blindedElements: [P384._VOPRF.BlindedElement]) throws -> P384._VOPRF.BatchBlindEvaluation {
+        try self.evaluate(batch: blindedElements, using: .random)
+    }
+
     /// Compute the PRF without blinding or proof.
     ///
     /// - Parameter input: The input message for which to compute the PRF.
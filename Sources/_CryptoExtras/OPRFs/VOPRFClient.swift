@@ -32,7 +32,7 @@ extension OPRF {
             self.client.blindMessage(message, blind: blind)
         }
         
-        fileprivate func v8Finalize(message: Data, info: Data?, blind: G.Scalar, evaluatedElement: G.Element, proof: DLEQProof<G.Scalar>, publicKey: G.Element) throws -> Data {
+        fileprivate func v8Finalize(messages: [Data], info: Data?, blinds: [G.Scalar], evaluatedElements: [G.Element], proof: DLEQProof<G.Scalar>, publicKey: G.Element) throws -> [Data] {
             precondition(self.client.mode == .verifiable)
             let setupCtx = setupContext(mode: client.mode, suite: client.ciphersuite, v8CompatibilityMode: self.client.v8CompatibilityMode)
             let contextDST = "Context-".data(using: .utf8)! + setupCtx
@@ -44,20 +44,30 @@ extension OPRF {
             
             let u = publicKey + t
             
-            let blindedElement = self.blindMessage(message, blind: blind).blindedElement
+            let blindedElements = zip(messages, blinds).map { self.blindMessage($0, blind: $1).blindedElement }
             guard try DLEQ<H2G>.verifyProof(A: H2G.G.Element.generator, B: u,
-                                            CDs: [(C: evaluatedElement, D: blindedElement)],
+                                            CDs: zip(evaluatedElements, blindedElements).map { (C: $0, D: $1) },
                                             proof: proof,
                                             dst: setupContext(mode: client.mode, suite: client.ciphersuite, v8CompatibilityMode: self.client.v8CompatibilityMode), v8CompatibilityMode: self.client.v8CompatibilityMode) else {
                 throw OPRF.Errors.invalidProof
             }
             
-            return try self.client.finalize(message: message, info: info, blind: blind, evaluatedElement: evaluatedElement)
+            return try self.unblindAndFinalize(messages: messages, info: info, blinds: blinds, evaluatedElements: evaluatedElements)
             
         }
         
         func finalize(message: Data, info: Data?, blind: G.Scalar, evaluatedElement: G.Element, proof: DLEQProof<G.Scalar>, publicKey: G.Element) throws -> Data {
-            if self.client.v8CompatibilityMode { return try v8Finalize(message: message, info: info, blind: blind, evaluatedElement: evaluatedElement, proof: proof, publicKey: publicKey) }
+            try self.finalize(messages: [message], info: info, blinds: [blind], evaluatedElements: [evaluatedElement], proof: proof, publicKey: publicKey)[0]
+        }
+        
+        /// Verifies a single proof covering a batch of evaluated elements, then finalizes each message. The messages,
+        /// blinds and evaluated elements correspond by index.
+        func finalize(messages: [Data], info: Data?, blinds: [G.Scalar], evaluatedElements: [G.Element], proof: DLEQProof<G.Scalar>, publicKey: G.Element) throws -> [Data] {
+            guard !messages.isEmpty, blinds.count == messages.count, evaluatedElements.count == messages.count else {
+                throw OPRF.Errors.incorrectBatchSize
+            }
+            
+            if self.client.v8CompatibilityMode { return try v8Finalize(messages: messages, info: info, blinds: blinds, evaluatedElements: evaluatedElements, proof: proof, publicKey: publicKey) }
             
             let hasInfo = (info != nil)
             if hasInfo && (self.client.mode == .verifiable) {
@@ -65,17 +75,17 @@ extension OPRF {
             }
             
             let setupCtx = setupContext(mode: client.mode, suite: client.ciphersuite, v8CompatibilityMode: self.client.v8CompatibilityMode)
-            let blindedElement = self.blindMessage(message, blind: blind).blindedElement
+            let blindedElements = zip(messages, blinds).map { self.blindMessage($0, blind: $1).blindedElement }
 
             if self.client.mode == .verifiable {
                 guard try DLEQ<H2G>.verifyProof(A: H2G.G.Element.generator, B: publicKey,
-                                                CDs: [(C: blindedElement, D: evaluatedElement)],
+                                                CDs: zip(blindedElements, evaluatedElements).map { (C: $0, D: $1) },
                                                 proof: proof,
                                                 dst: setupContext(mode: client.mode, suite: client.ciphersuite, v8CompatibilityMode: self.client.v8CompatibilityMode), v8CompatibilityMode: self.client.v8CompatibilityMode) else {
                     throw OPRF.Errors.invalidProof
                 }
                 
-                return try self.client.finalize(message: message, info: info, blind: blind, evaluatedElement: evaluatedElement)
+                return try self.unblindAndFinalize(messages: messages, info: info, blinds: blinds, evaluatedElements: evaluatedElements)
             }
             
             precondition(self.client.mode == .partiallyOblivious)
@@ -86,13 +96,19 @@ extension OPRF {
             
             let tweakedKey = T + publicKey
             guard try DLEQ<H2G>.verifyProof(A: H2G.G.Element.generator, B: tweakedKey,
-                                            CDs: [(C: evaluatedElement, D: blindedElement)],
+                                            CDs: zip(evaluatedElements, blindedElements).map { (C: $0, D: $1) },
                                             proof: proof,
                                             dst: setupContext(mode: client.mode, suite: client.ciphersuite, v8CompatibilityMode: self.client.v8CompatibilityMode), v8CompatibilityMode: self.client.v8CompatibilityMode) else {
                 throw OPRF.Errors.invalidProof
             }
             
-            return try self.client.finalize(message: message, info: info, blind: blind, evaluatedElement: evaluatedElement)
+            return try self.unblindAndFinalize(messages: messages, info: info, blinds: blinds, evaluatedElements: evaluatedElements)
+        }
+        
+        private func unblindAndFinalize(messages: [Data], info: Data?, blinds: [G.Scalar], evaluatedElements: [G.Element]) throws -> [Data] {
+            try zip(zip(messages, blinds), evaluatedElements).map { input, evaluatedElement in
+                try self.client.finalize(message: input.0, info: info, blind: input.1, evaluatedElement: evaluatedElement)
+            }
         }
         
     }
@@ -46,6 +46,20 @@ extension OPRF {
             return (evaluatedElement, proof!)
         }
         
+        func evaluate(blindedElements: [G.Element], info: Data? = nil, proofScalar: G.Scalar = G.Scalar.random) throws ->
+        ([G.Element], DLEQProof<H2G.G.Element.Scalar>) {
+            let hasInfo = (info != nil)
+            if hasInfo && self.server.mode == .verifiable && !server.v8CompatibilityMode {
+                throw OPRF.Errors.invalidModeForInfo
+            }
+            
+            let (evaluatedElements, proof) = try self.server.evaluate(blindedElements: blindedElements,
+                                                                      info: info,
+                                                                      proofScalar: proofScalar)
+            
+            return (evaluatedElements, proof!)
+        }
+        
         internal func verifyFinalize(msg: Data,
                                      output: Data,
                                      info: Data?) throws -> Bool {
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_implementationOnly import CCryptoBoringSSL
+@_implementationOnly import CCryptoBoringSSLShims
+import Crypto
+import Foundation
+
+/// A P-256 public key together with BoringSSL's table of its multiples.
+///
+/// The table is immutable once built, so a prepared key can be shared freely between threads.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+final class BoringSSLP256PreparedPublicKey: @unchecked Sendable {
+    private let table: OpaquePointer
+
+    /// The number of bytes of memory held by the table.
+    let byteCount: Int
+
+    init(x963Representation: Data) throws {
+        guard let key = CCryptoBoringSSL_EC_KEY_new_by_curve_name(NID_X9_62_prime256v1) else {
+            throw CryptoKitError.internalBoringSSLError()
+        }
+        defer { CCryptoBoringSSL_EC_KEY_free(key) }
+        let parsed = x963Representation.withUnsafeBytes { bytes in
+            CCryptoBoringSSL_EC_KEY_oct2key(key, bytes.baseAddress, bytes.count, nil)
+        }
+        guard parsed == 1,
+            let table = CCryptoBoringSSL_EC_POINT_TABLE_new(
+                CCryptoBoringSSL_EC_KEY_get0_group(key),
+                CCryptoBoringSSL_EC_KEY_get0_public_key(key)
+            )
+        else {
+            throw CryptoKitError.internalBoringSSLError()
+        }
+        self.table = table
+        self.byteCount = CCryptoBoringSSL_EC_POINT_TABLE_size(table)
+    }
+
+    deinit {
+        CCryptoBoringSSL_EC_POINT_TABLE_free(self.table)
+    }
+
+    func isValidSignature<D: Digest>(rawRepresentation signature: Data, for digest: D) -> Bool {
+        digest.withUnsafeBytes { digestBytes in
+            signature.withUnsafeBytes { signatureBytes in
+                CCryptoBoringSSLShims_ECDSA_verify_p1363_with_table(
+                    digestBytes.baseAddress,
+                    digestBytes.count,
+                    signatureBytes.baseAddress,
+                    signatureBytes.count,
+                    self.table
+                ) == 1
+            }
+        }
+    }
+
+    /// Returns the x-coordinate of the product of `privateKey` and this key.
+    func sharedSecret(with privateKey: P256.KeyAgreement.PrivateKey) throws -> SymmetricKey {
+        guard let key = CCryptoBoringSSL_EC_KEY_new_by_curve_name(NID_X9_62_prime256v1) else {
+            throw CryptoKitError.internalBoringSSLError()
+        }
+        defer { CCryptoBoringSSL_EC_KEY_free(key) }
+
+        // The private key's own EC_KEY and SecureBytes are internal to Crypto, so the scalar can only be had as
+        // `Data`. That copy is ours alone, so erase it as soon as BoringSSL has parsed it.
+        var rawRepresentation = privateKey.rawRepresentation
+        let parsed = rawRepresentation.withUnsafeMutableBytes { bytes in
+            defer { CCryptoBoringSSL_OPENSSL_cleanse(bytes.baseAddress, bytes.count) }
+            return CCryptoBoringSSL_EC_KEY_oct2priv(key, bytes.baseAddress, bytes.count)
+        }
+        guard parsed == 1 else {
+            throw CryptoKitError.internalBoringSSLError()
+        }
+
+        // Likewise, the secret is computed into a buffer that is erased once `SymmetricKey` has copied it into its
+        // own storage.
+        return try withUnsafeTemporaryAllocation(byteCount: 32, alignment: 1) { sharedSecret in
+            defer { CCryptoBoringSSL_OPENSSL_cleanse(sharedSecret.baseAddress, sharedSecret.count) }
+            let written = CCryptoBoringSSL_ECDH_compute_key_with_table(
+                sharedSecret.baseAddress,
+                sharedSecret.count,
+                self.table,
+                key
+            )
+            guard written == sharedSecret.count else {
+                throw CryptoKitError.internalBoringSSLError()
+            }
+            return SymmetricKey(data: UnsafeRawBufferPointer(sharedSecret))
+        }
+    }
+}
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// NOTE: This file is unconditionally compiled because prepared keys are implemented using BoringSSL on all platforms.
+import Crypto
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension P256.Signing {
+    /// A P-256 public key prepared for verifying many signatures.
+    ///
+    /// Preparing a key builds a table of about 80 kB of its multiples, which costs about as much as verifying four
+    /// signatures. Each verification with the prepared key is then two to three times faster than with
+    /// ``P256/Signing/PublicKey``, so it pays off for keys that are expected to sign more than a handful of the
+    /// signatures being verified, such as those of frequently-seen issuers. Use ``P256/_PreparedPublicKeyCache`` to
+    /// keep prepared keys for the hottest of a larger set of keys within a memory budget.
+    public struct _PreparedPublicKey: Sendable {
+        let backing: BoringSSLP256PreparedPublicKey
+
+        /// The public key that was prepared.
+        public let publicKey: P256.Signing.PublicKey
+
+        /// Prepares a public key.
+        ///
+        /// - Parameter publicKey: The key to prepare.
+        public init(_ publicKey: P256.Signing.PublicKey) throws {
+            self.init(
+                publicKey: publicKey,
+                backing: try BoringSSLP256PreparedPublicKey(x963Representation: publicKey.x963Representation)
+            )
+        }
+
+        init(publicKey: P256.Signing.PublicKey, backing: BoringSSLP256PreparedPublicKey) {
+            self.publicKey = publicKey
+            self.backing = backing
+        }
+
+        /// The number of bytes of memory held by this prepared key.
+        public var _byteCount: Int {
+            self.backing.byteCount
+        }
+
+        /// Verifies an ECDSA signature over P-256 of a digest.
+        ///
+        /// This accepts exactly the signatures that the public key's `isValidSignature(_:for:)` accepts.
+        ///
+        /// - Parameters:
+        ///   - signature: The signature to verify.
+        ///   - digest: The signed digest.
+        /// - Returns: A Boolean value that's `true` if the signature is valid for the given digest.
+        public func isValidSignature<D: Digest>(_ signature: P256.Signing.ECDSASignature, for digest: D) -> Bool {
+            self.backing.isValidSignature(rawRepresentation: signature.rawRepresentation, for: digest)
+        }
+
+        /// Verifies an ECDSA signature over P-256 of the SHA-256 digest of some data.
+        ///
+        /// - Parameters:
+        ///   - signature: The signature to verify.
+        ///   - data: The signed data.
+        /// - Returns: A Boolean value that's `true` if the signature is valid for the given data.
+        public func isValidSignature<D: DataProtocol>(_ signature: P256.Signing.ECDSASignature, for data: D) -> Bool {
+            self.isValidSignature(signature, for: SHA256.hash(data: data))
+        }
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension P256.KeyAgreement {
+    /// A P-256 public key prepared for repeated key agreement with a long-lived peer.
+    ///
+    /// Preparing a key builds a table of about 80 kB of its multiples, which costs about as much as four key
+    /// agreements. Each key agreement with the prepared key is then two to three times faster. The private key is
+    /// treated as secret throughout.
+    public struct _PreparedPublicKey: Sendable {
+        let backing: BoringSSLP256PreparedPublicKey
+
+        /// The public key that was prepared.
+        public let publicKey: P256.KeyAgreement.PublicKey
+
+        /// Prepares a public key.
+        ///
+        /// - Parameter publicKey: The key to prepare.
+        public init(_ publicKey: P256.KeyAgreement.PublicKey) throws {
+            self.init(
+                publicKey: publicKey,
+                backing: try BoringSSLP256PreparedPublicKey(x963Representation: publicKey.x963Representation)
+            )
+        }
+
+        init(publicKey: P256.KeyAgreement.PublicKey, backing: BoringSSLP256PreparedPublicKey) {
+            self.publicKey = publicKey
+            self.backing = backing
+        }
+
+        /// The number of bytes of memory held by this prepared key.
+        public var _byteCount: Int {
+            self.backing.byteCount
+        }
+    }
+}
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension P256.KeyAgreement.PrivateKey {
+    /// Computes a shared secret with a prepared public key.
+    ///
+    /// This computes the same secret as ``sharedSecretFromKeyAgreement(with:)``. `SharedSecret` can only be created
+    /// by CryptoKit, so the secret is returned as a `SymmetricKey` holding its bytes, from which keys can be derived
+    /// with `HKDF`.
+    ///
+    /// - Parameter preparedPublicKeyShare: The other party's prepared public key.
+    /// - Returns: The 32-byte shared secret.
+    public func _sharedSecretFromKeyAgreement(
+        with preparedPublicKeyShare: P256.KeyAgreement._PreparedPublicKey
+    ) throws -> SymmetricKey {
+        try preparedPublicKeyShare.backing.sharedSecret(with: self)
+    }
+}
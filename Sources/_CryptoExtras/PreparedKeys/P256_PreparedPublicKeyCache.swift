@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension P256 {
+    /// A cache of prepared P-256 public keys that keeps its memory use within a budget.
+    ///
+    /// The cache prepares each key the first time it is asked for, and keeps the most recently used prepared keys that
+    /// fit within `maximumByteCount` bytes, evicting the least recently used ones to make room. A prepared key takes
+    /// about 80 kB, so a budget of 16 MB holds around 200 keys. Keys are identified by their point, so a signing key
+    /// and a key agreement key with the same point share one table.
+    ///
+    /// Prepared keys handed out by the cache stay valid after they are evicted. The cache can be used from multiple
+    /// threads at once.
+    public final class _PreparedPublicKeyCache: @unchecked Sendable {
+        private struct Entry {
+            var backing: BoringSSLP256PreparedPublicKey
+            var lastUse: UInt64
+        }
+
+        /// The most memory that the cache's prepared keys may hold, in bytes.
+        public let maximumByteCount: Int
+
+        // All of these are protected by `lock`.
+        private let lock = NSLock()
+        private var entries: [Data: Entry] = [:]
+        private var clock: UInt64 = 0
+        private var _byteCount = 0
+
+        /// Creates an empty cache.
+        ///
+        /// - Parameter maximumByteCount: The most memory that the cache's prepared keys may hold, in bytes.
+        public init(maximumByteCount: Int) {
+            precondition(maximumByteCount >= 0, "maximumByteCount must not be negative")
+            self.maximumByteCount = maximumByteCount
+        }
+
+        /// The number of prepared keys in the cache.
+        public var count: Int {
+            self.lock.lock()
+            defer { self.lock.unlock() }
+            return self.entries.count
+        }
+
+        /// The memory held by the cache's prepared keys, in bytes.
+        public var byteCount: Int {
+            self.lock.lock()
+            defer { self.lock.unlock() }
+            return self._byteCount
+        }
+
+        /// Returns `publicKey` prepared for verifying signatures, preparing it if it isn't already cached.
+        ///
+        /// - Parameter publicKey: The key to prepare.
+        /// - Returns: The prepared key.
+        public func preparedKey(for publicKey: P256.Signing.PublicKey) throws -> P256.Signing._PreparedPublicKey {
+            P256.Signing._PreparedPublicKey(
+                publicKey: publicKey,
+                backing: try self.backing(for: publicKey.x963Representation)
+            )
+        }
+
+        /// Returns `publicKey` prepared for key agreement, preparing it if it isn't already cached.
+        ///
+        /// - Parameter publicKey: The key to prepare.
+        /// - Returns: The prepared key.
+        public func preparedKey(
+            for publicKey: P256.KeyAgreement.PublicKey
+        ) throws -> P256.KeyAgreement._PreparedPublicKey {
+            P256.KeyAgreement._PreparedPublicKey(
+                publicKey: publicKey,
+                backing: try self.backing(for: publicKey.x963Representation)
+            )
+        }
+
+        /// Removes every prepared key from the cache.
+        public func removeAll() {
+            self.lock.lock()
+            defer { self.lock.unlock() }
+            self.entries.removeAll()
+            self._byteCount = 0
+        }
+
+        private func backing(for x963Representation: Data) throws -> BoringSSLP256PreparedPublicKey {
+            if let backing = self.cachedBacking(for: x963Representation) {
+                return backing
+            }
+
+            // The key is prepared without holding the lock, so that other threads can use the cache meanwhile. If two
+            // threads prepare the same key at once, the first to finish is kept.
+            let backing = try BoringSSLP256PreparedPublicKey(x963Representation: x963Representation)
+
+            self.lock.lock()
+            defer { self.lock.unlock() }
+            if let existing = self.entries[x963Representation] {
+                return existing.backing
+            }
+            guard backing.byteCount <= self.maximumByteCount else {
+                return backing
+            }
+
+            // Finding the least recently used key scans the cache, which is cheap next to preparing a key.
+            while self._byteCount + backing.byteCount > self.maximumByteCount,
+                let leastRecentlyUsed = self.entries.min(by: { $0.value.lastUse < $1.value.lastUse })
+            {
+                self.entries.removeValue(forKey: leastRecentlyUsed.key)
+                self._byteCount -= leastRecentlyUsed.value.backing.byteCount
+            }
+            self.clock += 1
+            self.entries[x963Representation] = Entry(backing: backing, lastUse: self.clock)
+            self._byteCount += backing.byteCount
+            return backing
+        }
+
+        private func cachedBacking(for x963Representation: Data) -> BoringSSLP256PreparedPublicKey? {
+            self.lock.lock()
+            defer { self.lock.unlock() }
+            guard let entry = self.entries[x963Representation] else {
+                return nil
+            }
+            self.clock += 1
+            self.entries[x963Representation]!.lastUse = self.clock
+            return entry.backing
+        }
+    }
+}
@@ -19,6 +19,10 @@ import Crypto
 import CryptoBoringWrapper
 import Foundation
 
+#if canImport(Dispatch)
+import Dispatch
+#endif
+
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 internal struct BoringSSLRSAPublicKey: Sendable {
     private var backing: Backing
@@ -141,6 +145,14 @@ extension BoringSSLRSAPrivateKey {
     {
         try self.backing.blindSignature(for: message)
     }
+
+    internal func blindSignatures<D: DataProtocol>(
+        for messages: [D]
+    ) throws
+        -> [_RSA.BlindSigning.BlindSignature]
+    {
+        try self.backing.blindSignatures(for: messages)
+    }
 }
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
@@ -937,6 +949,39 @@ extension BoringSSLRSAPrivateKey {
             return signature
         }
 
+        fileprivate func blindSignatures<D: DataProtocol>(
+            for messages: [D]
+        ) throws
+            -> [_RSA.BlindSigning.BlindSignature]
+        {
+            // The Montgomery contexts and blinding cache live on the key, so after the first message every signature
+            // reuses them. Each signature costs a full private key operation, so even one message is worth handing to
+            // another thread.
+            var results = [Result<_RSA.BlindSigning.BlindSignature, any Error>?](repeating: nil, count: messages.count)
+            results.withUnsafeMutableBufferPointer { results in
+                func sign(_ indices: Range<Int>) {
+                    for index in indices {
+                        results[index] = Result { try self.blindSignature(for: messages[index]) }
+                    }
+                }
+
+                #if canImport(Dispatch)
+                let threadCount = min(ProcessInfo.processInfo.activeProcessorCount, messages.count)
+                if threadCount > 1 {
+                    DispatchQueue.concurrentPerform(iterations: threadCount) { thread in
+                        let start = messages.count * thread / threadCount
+                        let end = messages.count * (thread + 1) / threadCount
+                        sign(start..<end)
+                    }
+                    return
+                }
+                #endif
+                sign(0..<messages.count)
+            }
+
+            return try results.map { try $0!.get() }
+        }
+
         fileprivate func verifyBlindSignature<D: ContiguousBytes>(
             _ signature: _RSA.BlindSigning.BlindSignature,
             for blindedMessage: D
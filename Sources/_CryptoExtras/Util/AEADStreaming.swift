@@ -0,0 +1,487 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import CryptoBoringWrapper
+import Foundation
+
+/// The shared implementation of ``_AEADEncryptor`` and ``_AEADDecryptor``.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+extension BoringSSLAEAD.IncrementalContext {
+    static func streaming<Nonce: ContiguousBytes, AuthenticatedData: DataProtocol>(
+        cipher: BoringSSLAEAD,
+        key: SymmetricKey,
+        nonce: Nonce,
+        authenticatedData: AuthenticatedData,
+        operation: Operation
+    ) throws -> BoringSSLAEAD.IncrementalContext {
+        try withCryptoKitErrors {
+            let context = try BoringSSLAEAD.IncrementalContext(
+                cipher: cipher,
+                key: key,
+                nonce: nonce,
+                operation: operation
+            )
+            try context.authenticate(authenticatedData)
+            return context
+        }
+    }
+
+    func streamingUpdate<Input: DataProtocol>(_ input: Input) throws -> Data {
+        let byteCount = input.count
+        var output = Data(count: byteCount)
+        _ = try output.withUnsafeMutableBytes { outputBytes in
+            try self.streamingUpdate(input, into: outputBytes)
+        }
+        return output
+    }
+
+    @discardableResult
+    func streamingUpdate<Input: DataProtocol>(
+        _ input: Input,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        try withCryptoKitErrors {
+            try self.update(contentsOf: input, into: output)
+        }
+    }
+
+    func streamingFinalize() throws -> Data {
+        var tag = Data(count: Self.tagByteCount)
+        _ = try tag.withUnsafeMutableBytes { tagBytes in
+            try withCryptoKitErrors {
+                try self.finalize(tagInto: tagBytes)
+            }
+        }
+        return tag
+    }
+
+    func streamingFinalize<Tag: DataProtocol>(verifying tag: Tag) throws {
+        let contiguousTag = Array(tag)
+        try contiguousTag.withUnsafeBytes { tagBytes in
+            do {
+                try self.finalize(verifying: tagBytes)
+            } catch {
+                // A decryptor can only be finalized once, so the tag not authenticating the message is the only way
+                // this fails.
+                throw CryptoKitError.authenticationFailure
+            }
+        }
+    }
+}
+
+/// An AEAD whose messages can be sealed and opened a piece at a time, and that streams can be sealed with.
+///
+/// This lets ``_AEADEncryptor``, ``_AEADDecryptor``, ``_AEADSTREAMSealer`` and ``_AEADSTREAMOpener`` be written
+/// once for every cipher. Only `AES.GCM` and `ChaChaPoly` conform: other types have no way to make a
+/// ``_StreamingAEADImplementation``.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public protocol _StreamingAEAD {
+    /// The type of the nonces that messages are sealed under.
+    associatedtype Nonce: ContiguousBytes
+
+    /// This module's implementation of the cipher.
+    static var _streamingImplementation: _StreamingAEADImplementation<Nonce> { get }
+}
+
+/// This module's implementation of a ``_StreamingAEAD``. It has no public members.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct _StreamingAEADImplementation<Nonce> {
+    /// The BoringSSL cipher matching the size of a key.
+    let boringSSLAEAD: (SymmetricKey) throws -> BoringSSLAEAD
+
+    /// The HKDF info for this cipher's STREAM subkeys, which keeps them apart from other ciphers' under the same key.
+    let streamSubkeyInfo: [UInt8]
+
+    /// Generates a random nonce.
+    let randomNonce: () -> Nonce
+}
+
+/// Seals a single message a piece at a time, so that the whole message never needs to be in memory.
+///
+/// Pass the message to ``update(_:)`` in as many pieces as is convenient, then call ``finalize()`` to get the
+/// authentication tag. The ciphertext and tag are the same as the ones the cipher's one-shot `seal` produces for the
+/// whole message, so either can be opened with ``_AEADDecryptor`` or the one-shot `open`.
+///
+/// An encryptor can't be copied, as two copies would encrypt different data under the same nonce.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct _AEADEncryptor<Cipher: _StreamingAEAD>: ~Copyable {
+    private let context: BoringSSLAEAD.IncrementalContext
+
+    /// The nonce the message is being sealed under.
+    public let nonce: Cipher.Nonce
+
+    /// Creates an encryptor for a single message.
+    ///
+    /// - Parameters:
+    ///   - key: An encryption key of a size the cipher supports.
+    ///   - nonce: The nonce the sealing process requires. If you don't provide a nonce, the method generates a random
+    ///     one.
+    ///   - authenticatedData: Additional data to be authenticated.
+    public init<AuthenticatedData: DataProtocol>(
+        key: SymmetricKey,
+        nonce: Cipher.Nonce? = nil,
+        authenticating authenticatedData: AuthenticatedData
+    ) throws {
+        let implementation = Cipher._streamingImplementation
+        let nonce = nonce ?? implementation.randomNonce()
+        self.context = try .streaming(
+            cipher: implementation.boringSSLAEAD(key),
+            key: key,
+            nonce: nonce,
+            authenticatedData: authenticatedData,
+            operation: .seal
+        )
+        self.nonce = nonce
+    }
+
+    /// Creates an encryptor for a single message.
+    ///
+    /// - Parameters:
+    ///   - key: An encryption key of a size the cipher supports.
+    ///   - nonce: The nonce the sealing process requires. If you don't provide a nonce, the method generates a random
+    ///     one.
+    public init(key: SymmetricKey, nonce: Cipher.Nonce? = nil) throws {
+        try self.init(key: key, nonce: nonce, authenticating: Data())
+    }
+
+    /// Encrypts the next piece of the message.
+    ///
+    /// - Parameter plaintext: The next piece of the message.
+    /// - Returns: The ciphertext for `plaintext`, which is always the same size.
+    public mutating func update<Plaintext: DataProtocol>(_ plaintext: Plaintext) throws -> Data {
+        try self.context.streamingUpdate(plaintext)
+    }
+
+    /// Encrypts the next piece of the message into caller-provided memory, without allocating.
+    ///
+    /// - Parameters:
+    ///   - plaintext: The next piece of the message.
+    ///   - output: The memory to write the ciphertext to. It must be at least as long as `plaintext`.
+    /// - Returns: The number of bytes written to `output`.
+    @discardableResult
+    public mutating func update<Plaintext: DataProtocol>(
+        _ plaintext: Plaintext,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        try self.context.streamingUpdate(plaintext, into: output)
+    }
+
+    /// Completes the message.
+    ///
+    /// - Returns: The 16-byte authentication tag.
+    public consuming func finalize() throws -> Data {
+        try self.context.streamingFinalize()
+    }
+}
+
+/// Opens a single message a piece at a time, so that the whole message never needs to be in memory.
+///
+/// - Important: ``update(_:)`` returns plaintext before it has been authenticated. Don't act on any of it, or
+///   release it to anything that might, until ``finalize(verifying:)`` has returned successfully. If the message
+///   needs to be consumed as it arrives, seal it with ``_AEADSTREAMSealer`` instead.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct _AEADDecryptor<Cipher: _StreamingAEAD>: ~Copyable {
+    private let context: BoringSSLAEAD.IncrementalContext
+
+    /// Creates a decryptor for a single message.
+    ///
+    /// - Parameters:
+    ///   - key: The key the message was sealed with.
+    ///   - nonce: The nonce the message was sealed with.
+    ///   - authenticatedData: Additional data that was authenticated.
+    public init<AuthenticatedData: DataProtocol>(
+        key: SymmetricKey,
+        nonce: Cipher.Nonce,
+        authenticating authenticatedData: AuthenticatedData
+    ) throws {
+        self.context = try .streaming(
+            cipher: Cipher._streamingImplementation.boringSSLAEAD(key),
+            key: key,
+            nonce: nonce,
+            authenticatedData: authenticatedData,
+            operation: .open
+        )
+    }
+
+    /// Creates a decryptor for a single message.
+    ///
+    /// - Parameters:
+    ///   - key: The key the message was sealed with.
+    ///   - nonce: The nonce the message was sealed with.
+    public init(key: SymmetricKey, nonce: Cipher.Nonce) throws {
+        try self.init(key: key, nonce: nonce, authenticating: Data())
+    }
+
+    /// Decrypts the next piece of the message.
+    ///
+    /// - Parameter ciphertext: The next piece of the ciphertext.
+    /// - Returns: The unauthenticated plaintext for `ciphertext`, which is always the same size.
+    public mutating func update<Ciphertext: DataProtocol>(_ ciphertext: Ciphertext) throws -> Data {
+        try self.context.streamingUpdate(ciphertext)
+    }
+
+    /// Decrypts the next piece of the message into caller-provided memory, without allocating.
+    ///
+    /// - Parameters:
+    ///   - ciphertext: The next piece of the ciphertext.
+    ///   - output: The memory to write the unauthenticated plaintext to. It must be at least as long as `ciphertext`.
+    /// - Returns: The number of bytes written to `output`.
+    @discardableResult
+    public mutating func update<Ciphertext: DataProtocol>(
+        _ ciphertext: Ciphertext,
+        into output: UnsafeMutableRawBufferPointer
+    ) throws -> Int {
+        try self.context.streamingUpdate(ciphertext, into: output)
+    }
+
+    /// Completes the message, throwing ``CryptoKitError/authenticationFailure`` if `tag` doesn't authenticate it.
+    ///
+    /// - Parameter tag: The authentication tag the message was sealed with.
+    public consuming func finalize<Tag: DataProtocol>(verifying tag: Tag) throws {
+        try self.context.streamingFinalize(verifying: tag)
+    }
+}
+
+/// The header that starts every stream: the salt its subkey was derived with, followed by its nonce prefix.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+struct STREAMHeader {
+    static let saltByteCount = 32
+    static let byteCount = saltByteCount + STREAMNonceSequence.prefixByteCount
+
+    let salt: [UInt8]
+    let noncePrefix: [UInt8]
+
+    /// Creates the header for a new stream, with a random salt and nonce prefix.
+    init() {
+        self.salt = SystemRandomNumberGenerator.randomBytes(count: Self.saltByteCount)
+        self.noncePrefix = SystemRandomNumberGenerator.randomBytes(count: STREAMNonceSequence.prefixByteCount)
+    }
+
+    init<Bytes: DataProtocol>(_ bytes: Bytes) throws {
+        guard bytes.count == Self.byteCount else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+        let bytes = Array(bytes)
+        self.salt = Array(bytes.prefix(Self.saltByteCount))
+        self.noncePrefix = Array(bytes.dropFirst(Self.saltByteCount))
+    }
+
+    var bytes: Data {
+        Data(self.salt + self.noncePrefix)
+    }
+
+    /// Derives the stream's subkey from `key` and creates a context for it.
+    func makeContext<Cipher: _StreamingAEAD>(
+        for _: Cipher.Type,
+        key: SymmetricKey
+    ) throws -> BoringSSLAEAD.AEADContext {
+        let implementation = Cipher._streamingImplementation
+        let aead = try implementation.boringSSLAEAD(key)
+        let subkey = HKDF<SHA256>.deriveKey(
+            inputKeyMaterial: key,
+            salt: self.salt,
+            info: implementation.streamSubkeyInfo,
+            outputByteCount: key.bitCount / 8
+        )
+        return try withCryptoKitErrors {
+            try BoringSSLAEAD.AEADContext(cipher: aead, key: subkey, preparingForDiscontiguousInput: true)
+        }
+    }
+}
+
+/// Seals a stream as a sequence of separately authenticated chunks, using the STREAM construction.
+///
+/// Each stream is sealed under its own subkey, derived from `key` and a random 32-byte salt with HKDF-SHA256, as
+/// Tink's streaming AEADs do. Each chunk is sealed under a nonce made of a random 7-byte prefix, a 4-byte big-endian
+/// chunk counter and a 1-byte flag marking the last chunk. Nonces then only have to be unique within a stream, rather
+/// than across every stream the key ever seals, so the prefix doesn't limit how many streams a key can seal.
+/// ``_AEADSTREAMOpener`` can release each chunk's plaintext as soon as it has been opened, while still detecting
+/// chunks that have been reordered, dropped or repeated, and streams that have been truncated.
+///
+/// A stream can have at most 2^32 chunks, and each chunk is limited to the cipher's maximum message size.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct _AEADSTREAMSealer<Cipher: _StreamingAEAD>: ~Copyable {
+    private let context: BoringSSLAEAD.AEADContext
+    private let authenticatedData: Data
+    private var nonces: STREAMNonceSequence
+
+    /// The 39-byte stream header, which the opener needs to be given. It is made of the salt the stream's subkey was
+    /// derived with and the prefix of every nonce in the stream, so it needn't be kept secret.
+    public let header: Data
+
+    /// Creates a sealer for a new stream with a random header.
+    ///
+    /// - Parameters:
+    ///   - key: An encryption key of a size the cipher supports.
+    ///   - authenticatedData: Additional data to be authenticated with every chunk.
+    public init<AuthenticatedData: DataProtocol>(
+        key: SymmetricKey,
+        authenticating authenticatedData: AuthenticatedData
+    ) throws {
+        let header = STREAMHeader()
+        self.context = try header.makeContext(for: Cipher.self, key: key)
+        self.authenticatedData = Data(authenticatedData)
+        self.nonces = try STREAMNonceSequence(prefix: header.noncePrefix)
+        self.header = header.bytes
+    }
+
+    /// Creates a sealer for a new stream with a random header.
+    ///
+    /// - Parameter key: An encryption key of a size the cipher supports.
+    public init(key: SymmetricKey) throws {
+        try self.init(key: key, authenticating: Data())
+    }
+
+    /// Seals the next chunk of the stream.
+    ///
+    /// - Parameters:
+    ///   - chunk: The plaintext of the chunk.
+    ///   - isFinal: Whether this is the last chunk of the stream. No more chunks can be sealed after it.
+    /// - Returns: The chunk's ciphertext followed by its 16-byte authentication tag.
+    public mutating func seal<Chunk: DataProtocol>(_ chunk: Chunk, isFinal: Bool = false) throws -> Data {
+        let nonce = try self.nonces.nextNonce(isFinal: isFinal)
+        let context = self.context
+        let authenticatedData = self.authenticatedData
+        var sealed = Data()
+        try withCryptoKitErrors {
+            try context.seal(
+                message: chunk,
+                nonce: nonce,
+                authenticatedData: authenticatedData,
+                appendingTo: &sealed
+            )
+        }
+        self.nonces.advance(isFinal: isFinal)
+        return sealed
+    }
+}
+
+/// Opens a stream sealed by ``_AEADSTREAMSealer``, one chunk at a time.
+///
+/// The plaintext of each chunk is authenticated before it is returned, so it is safe to act on straight away.
+/// The stream is only complete once a chunk has been opened with `isFinal` set: if the input ends before then,
+/// the stream has been truncated.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct _AEADSTREAMOpener<Cipher: _StreamingAEAD>: ~Copyable {
+    private let context: BoringSSLAEAD.AEADContext
+    private let authenticatedData: Data
+    private var nonces: STREAMNonceSequence
+
+    /// Whether the final chunk of the stream has been opened.
+    public var isFinished: Bool {
+        self.nonces.isFinished
+    }
+
+    /// Creates an opener for a stream.
+    ///
+    /// - Parameters:
+    ///   - key: The key the stream was sealed with.
+    ///   - header: The ``_AEADSTREAMSealer/header`` of the sealer.
+    ///   - authenticatedData: Additional data that was authenticated with every chunk.
+    public init<Header: DataProtocol, AuthenticatedData: DataProtocol>(
+        key: SymmetricKey,
+        header: Header,
+        authenticating authenticatedData: AuthenticatedData
+    ) throws {
+        let header = try STREAMHeader(header)
+        self.context = try header.makeContext(for: Cipher.self, key: key)
+        self.authenticatedData = Data(authenticatedData)
+        self.nonces = try STREAMNonceSequence(prefix: header.noncePrefix)
+    }
+
+    /// Creates an opener for a stream.
+    ///
+    /// - Parameters:
+    ///   - key: The key the stream was sealed with.
+    ///   - header: The ``_AEADSTREAMSealer/header`` of the sealer.
+    public init<Header: DataProtocol>(key: SymmetricKey, header: Header) throws {
+        try self.init(key: key, header: header, authenticating: Data())
+    }
+
+    /// Opens the next chunk of the stream.
+    ///
+    /// - Parameters:
+    ///   - chunk: The chunk's ciphertext followed by its 16-byte authentication tag.
+    ///   - isFinal: Whether this is the last chunk of the stream.
+    /// - Returns: The authenticated plaintext of the chunk.
+    public mutating func open<Chunk: DataProtocol>(_ chunk: Chunk, isFinal: Bool = false) throws -> Data {
+        let nonce = try self.nonces.nextNonce(isFinal: isFinal)
+        let context = self.context
+        let authenticatedData = self.authenticatedData
+        var opened = Data()
+        try withCryptoKitErrors {
+            try context.open(
+                combinedCiphertextAndTag: chunk,
+                nonce: nonce,
+                authenticatedData: authenticatedData,
+                appendingTo: &opened
+            )
+        }
+        self.nonces.advance(isFinal: isFinal)
+        return opened
+    }
+}
+
+/// The nonces used by the STREAM online authenticated encryption construction.
+///
+/// STREAM, from Hoang, Reyhanitabar, Rogaway and Vizár's "Online Authenticated-Encryption and its Nonce-Reuse
+/// Misuse-Resistance", seals each chunk of a stream under a nonce made of a fixed per-stream prefix, a big-endian
+/// chunk counter and a flag marking the last chunk. Because the counter and flag are authenticated along with each
+/// chunk, a reader that opens chunks in order detects any chunk that has been reordered, dropped or repeated, and any
+/// stream that has been truncated.
+///
+/// The layout, a 7-byte prefix, a 4-byte counter and a 1-byte flag, is the one Tink's streaming AEADs use.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+struct STREAMNonceSequence {
+    static let prefixByteCount = 7
+
+    let prefix: [UInt8]
+    private var counter: UInt32
+    private(set) var isFinished: Bool
+
+    init(prefix: [UInt8]) throws {
+        guard prefix.count == Self.prefixByteCount else {
+            throw CryptoKitError.incorrectParameterSize
+        }
+        self.prefix = prefix
+        self.counter = 0
+        self.isFinished = false
+    }
+
+    /// The nonce for the next chunk. Call `advance(isFinal:)` once that chunk has been processed successfully.
+    func nextNonce(isFinal: Bool) throws -> [UInt8] {
+        guard !self.isFinished else {
+            throw CryptoKitError.invalidParameter
+        }
+        // The counter must not wrap, as that would reuse a nonce, so the last counter value is kept for a final chunk.
+        guard isFinal || self.counter < .max else {
+            throw CryptoKitError.invalidParameter
+        }
+
+        var nonce = self.prefix
+        nonce.reserveCapacity(Self.prefixByteCount + 5)
+        withUnsafeBytes(of: self.counter.bigEndian) { nonce.append(contentsOf: $0) }
+        nonce.append(isFinal ? 1 : 0)
+        return nonce
+    }
+
+    mutating func advance(isFinal: Bool) {
+        if isFinal {
+            self.isFinished = true
+        } else {
+            self.counter += 1
+        }
+    }
+}
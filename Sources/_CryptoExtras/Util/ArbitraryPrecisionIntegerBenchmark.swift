@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+import CryptoBoringWrapper
+
+/// Runs a single arbitrary-precision integer operation on fixed random operands.
+///
+/// The integer type is internal to this package, so this is how the benchmarks package measures its operations
+/// directly. It is only visible to clients that import this module with `@_spi(Benchmarks)`, and is not intended for
+/// any other use.
+@_spi(Benchmarks)
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+public struct _ArbitraryPrecisionIntegerBenchmark: Sendable {
+    /// An operation to measure.
+    public enum Operation: Sendable {
+        /// `a * b`.
+        case multiply
+        /// `a * b`, reduced modulo `m`.
+        case modularMultiply
+        /// The inverse of `a` modulo `m`.
+        case modularInverse
+        /// `a * b` divided by `m`.
+        case divide
+        /// The greatest common divisor of `a` and `m`.
+        case gcd
+    }
+
+    private let operation: @Sendable () throws -> Void
+
+    /// Prepares to run `operation` on random operands.
+    ///
+    /// - Parameters:
+    ///   - operation: The operation to run.
+    ///   - bitWidth: The width of `m`, which is odd, and the bound on `a` and `b`.
+    public init(_ operation: Operation, bitWidth: Int) throws {
+        precondition(bitWidth >= 2, "Operands must be at least two bits wide")
+        // 2^(bitWidth - 1), so that the modulus is exactly `bitWidth` bits wide.
+        let hexDigits = String(repeating: "0", count: (bitWidth - 1) / 4)
+        let lowerBound = try ArbitraryPrecisionInteger(hexString: String(1 << ((bitWidth - 1) % 4)) + hexDigits)
+
+        var modulus = try ArbitraryPrecisionInteger.random(inclusiveMin: 0, exclusiveMax: lowerBound) + lowerBound
+        if modulus.isEven {
+            modulus += 1
+        }
+        let b = try ArbitraryPrecisionInteger.random(inclusiveMin: 1, exclusiveMax: modulus)
+        var candidate: ArbitraryPrecisionInteger
+        repeat {
+            candidate = try ArbitraryPrecisionInteger.random(inclusiveMin: 1, exclusiveMax: modulus)
+        } while try !candidate.isCoprime(with: modulus)
+        let a = candidate
+
+        switch operation {
+        case .multiply:
+            self.operation = { _ = a * b }
+        case .modularMultiply:
+            self.operation = { _ = try a.mul(b, modulo: modulus) }
+        case .modularInverse:
+            self.operation = { _ = try a.inverse(modulo: modulus) }
+        case .divide:
+            let product = a * b
+            self.operation = { _ = product / modulus }
+        case .gcd:
+            self.operation = { _ = try ArbitraryPrecisionInteger.gcd(a, modulus) }
+        }
+    }
+
+    /// Runs the operation once.
+    public func callAsFunction() throws {
+        try self.operation()
+    }
+}
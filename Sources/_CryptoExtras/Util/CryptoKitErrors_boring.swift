@@ -14,6 +14,7 @@
 
 @_implementationOnly import CCryptoBoringSSL
 import Crypto
+import CryptoBoringWrapper
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
 extension CryptoKitError {
@@ -23,3 +24,15 @@ extension CryptoKitError {
         .underlyingCoreCryptoError(error: Int32(bitPattern: CCryptoBoringSSL_ERR_get_error()))
     }
 }
+
+/// Runs `body`, translating underlying BoringSSL errors reported by `CryptoBoringWrapper` into `CryptoKitError`s.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+func withCryptoKitErrors<T>(_ body: () throws -> T) throws -> T {
+    do {
+        return try body()
+    } catch CryptoBoringWrapperError.underlyingCoreCryptoError(let errorCode) {
+        throw CryptoKitError.underlyingCoreCryptoError(error: errorCode)
+    } catch CryptoBoringWrapperError.incorrectParameterSize {
+        throw CryptoKitError.incorrectParameterSize
+    }
+}
@@ -35,22 +35,20 @@ struct DLEQ<H2G: HashToGroup> {
     static func composites(k: GE.Scalar? = nil, B: GE, dst: Data, CDs: [(C: GE, D: GE)], v8CompatibilityMode: Bool) throws -> (M: GE, Z: GE) {
         let seedDST = "Seed-".data(using: .utf8)! + dst
         
-        let Bm = B.oprfRepresentation
+        // Serialize every point at once, so that they share the conversion to affine coordinates.
+        let serializedPoints = GE.oprfRepresentations(of: [B] + CDs.map { $0.C } + CDs.map { $0.D })
+        let Bm = serializedPoints[0]
         
         let h1Input = I2OSP(value: Bm.count, outputByteCount: 2) + Bm
         + I2OSP(value: seedDST.count, outputByteCount: 2) + seedDST
         let seed = Data(H2G.H.hash(data: h1Input))
 
-        var M: GE?
-        var Z: GE?
+        var weights: [GE.Scalar] = []
+        weights.reserveCapacity(CDs.count)
 
         for i in 0..<CDs.count {
-            let pair = CDs[i]
-            let Ci = pair.C
-            let Di = pair.D
-
-            let Cim = Ci.oprfRepresentation
-            let Dim = Di.oprfRepresentation
+            let Cim = serializedPoints[1 + i]
+            let Dim = serializedPoints[1 + CDs.count + i]
             
             var h2input = I2OSP(value: seed.count, outputByteCount: 2) + seed
             + I2OSP(value: i, outputByteCount: 2)
@@ -63,35 +61,28 @@ struct DLEQ<H2G: HashToGroup> {
                 h2input = h2input + Data("Composite".utf8)
             }
 
-            let di = try H2G.hashToScalar(h2input, domainSeparationString: dst)
-            if let m = M {
-                M = (di * Ci) + m
-            } else {
-                M = (di * Ci)
-            }
-            
-            if k == nil {
-                if let z = Z {
-                    Z = (di * Di) + z
-                } else {
-                    Z = (di * Di)
-                }
-            }
+            weights.append(try H2G.hashToScalar(h2input, domainSeparationString: dst))
         }
 
-        if k != nil {
-            Z = k! * M!
+        // The elements and their weights are all public, so the sums can use a variable-time multiplication.
+        let M = GE.publicMultiScalarMultiplication(zip(weights, CDs).map { ($0, $1.C) })
+        let Z: GE
+        if let k {
+            Z = k * M
+        } else {
+            Z = GE.publicMultiScalarMultiplication(zip(weights, CDs).map { ($0, $1.D) })
         }
 
-        return (M: M!, Z: Z!)
+        return (M: M, Z: Z)
     }
     
     static func composeChallenge(dst: Data, B: GE, M: GE, Z: GE, T2: GE, T3: GE, v8CompatibilityMode: Bool) throws -> GE.Scalar {
-        let Bm = B.oprfRepresentation
-        let A0 = M.oprfRepresentation
-        let A1 = Z.oprfRepresentation
-        let A2 = T2.oprfRepresentation
-        let A3 = T3.oprfRepresentation
+        let serializedPoints = GE.oprfRepresentations(of: [B, M, Z, T2, T3])
+        let Bm = serializedPoints[0]
+        let A0 = serializedPoints[1]
+        let A1 = serializedPoints[2]
+        let A2 = serializedPoints[3]
+        let A3 = serializedPoints[4]
         
         var h2Input = I2OSP(value: Bm.count, outputByteCount: 2) + Bm +
         I2OSP(value: A0.count, outputByteCount: 2) + A0 +
@@ -141,8 +132,8 @@ struct DLEQ<H2G: HashToGroup> {
                             CDs: [(C: GE, D: GE)],
                             proof: DLEQProof<GE.Scalar>, dst: Data, v8CompatibilityMode: Bool) throws -> Bool {
         let composites = try composites(B: B, dst: dst, CDs: CDs, v8CompatibilityMode: v8CompatibilityMode)
-        let t2 = (proof.s * A) + (proof.c * B)
-        let t3 = ((proof.s * composites.M) + (proof.c * composites.Z))
+        let t2 = GE.publicMultiScalarMultiplication([(proof.s, A), (proof.c, B)])
+        let t3 = GE.publicMultiScalarMultiplication([(proof.s, composites.M), (proof.c, composites.Z)])
         
         let c = try composeChallenge(dst: dst, B: B, M: composites.M, Z: composites.Z, T2: t2, T3: t3, v8CompatibilityMode: v8CompatibilityMode)
         
@@ -58,11 +58,12 @@ struct Verifier<H2G: HashToGroup>: ProofParticipant {
                 }
             }
 
-            // challenge * constraintPoint
-            let challengePoint = proof.challenge * self.points[constraintPoint.index]
-            let blindedPoint = (linearCombination).map { (scalar, point) in
-                proof.responses[scalar.index] * self.points[point.index]
-            }.reduce(challengePoint, +)
+            // challenge * constraintPoint + the responses times their points, all public, in one multiplication.
+            let terms = [(scalar: proof.challenge, element: self.points[constraintPoint.index])]
+                + linearCombination.map { (scalar, point) in
+                    (scalar: proof.responses[scalar.index], element: self.points[point.index])
+                }
+            let blindedPoint = Group.Element.publicMultiScalarMultiplication(terms)
 
             blindedPoints.append(blindedPoint)
             blindedPointsLabels.append(self.pointLabels[constraintPoint.index] + "-blind")
@@ -42,15 +42,9 @@ struct Proof<H2G: HashToGroup> {
     static func composeChallenge(label: String, points: [Group.Element], pointLabels: [String], blindedPoints: [Group.Element], blindedPointsLabels: [String], scalarLabels: [String]) throws -> Group.Scalar {
         var challengeInput = Data()
 
-        // Pass the public points into the transcript.
-        for point in points {
-            let serializedPoint = point.oprfRepresentation
-            challengeInput.append(I2OSP(value: serializedPoint.count, outputByteCount: 2) + serializedPoint)
-        }
-
-        // Pass the computed blinded points into the transcript.
-        for point in blindedPoints {
-            let serializedPoint = point.oprfRepresentation
+        // Pass the public points, then the computed blinded points, into the transcript. They are serialized together
+        // so that they share the conversion to affine coordinates.
+        for serializedPoint in Group.Element.oprfRepresentations(of: points + blindedPoints) {
             challengeInput.append(I2OSP(value: serializedPoint.count, outputByteCount: 2) + serializedPoint)
         }
 
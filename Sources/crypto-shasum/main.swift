@@ -12,6 +12,7 @@
 //
 //===----------------------------------------------------------------------===//
 import Foundation
+import Dispatch
 import Crypto
 
 let help = """
@@ -20,6 +21,8 @@ Print SHA checksums.
 With no FILE, or when FILE is -, read standard input.
 
   -a, --algorithm   256 (default), 384, 512
+  -j, --jobs        number of files to hash concurrently (default: number of cores)
+      --bench       report the hashing throughput of each algorithm instead of hashing files
 """
 
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
@@ -41,6 +44,12 @@ enum SupportedHashFunction {
         }
     }
 
+    static let allCases: [(name: String, algorithm: SupportedHashFunction)] = [
+        ("SHA256", .sha256),
+        ("SHA384", .sha384),
+        ("SHA512", .sha512),
+    ]
+
     func hashLoop(from input: FileHandle) -> Data {
         switch self {
         case .sha256:
@@ -52,7 +61,44 @@ enum SupportedHashFunction {
         }
     }
 
-    private static let readSize = 8192
+    func hash(_ bytes: UnsafeRawBufferPointer) -> Data {
+        switch self {
+        case .sha256:
+            var hasher = SHA256()
+            hasher.update(bufferPointer: bytes)
+            return Data(hasher.finalize())
+        case .sha384:
+            var hasher = SHA384()
+            hasher.update(bufferPointer: bytes)
+            return Data(hasher.finalize())
+        case .sha512:
+            var hasher = SHA512()
+            hasher.update(bufferPointer: bytes)
+            return Data(hasher.finalize())
+        }
+    }
+
+    /// Hashes the file at `path`.
+    ///
+    /// Regular files are memory mapped and hashed in place, so no memory is allocated per read. Anything else, such
+    /// as a pipe, is read a large chunk at a time.
+    func hash(fileAtPath path: String) throws -> Data {
+        if path == "-" {
+            return self.hashLoop(from: FileHandle.standardInput)
+        }
+
+        let attributes = try FileManager.default.attributesOfItem(atPath: path)
+        guard attributes[.type] as? FileAttributeType == .typeRegular else {
+            let handle = try FileHandle(forReadingFrom: URL(fileURLWithPath: path))
+            defer { try? handle.close() }
+            return self.hashLoop(from: handle)
+        }
+
+        let contents = try Data(contentsOf: URL(fileURLWithPath: path), options: .alwaysMapped)
+        return contents.withUnsafeBytes { self.hash($0) }
+    }
+
+    private static let readSize = 1 << 20
 
     private static func hashLoop<HF: HashFunction>(from input: FileHandle, with hasher: HF.Type) -> HF.Digest {
         var hasher = HF()
@@ -89,11 +135,68 @@ extension String {
     }
 }
 
+/// Hashes `paths` using up to `jobs` threads, printing each result in the order the paths were given.
+@available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
+func processInputs(_ paths: [String], algorithm: SupportedHashFunction, jobs: Int) {
+    let lock = NSLock()
+    var nextPath = 0
+    var results = [Result<Data, Error>?](repeating: nil, count: paths.count)
+    var nextResultToPrint = 0
+
+    // Print every result we can without getting ahead of one that's still being worked on. This must be called
+    // with the lock held.
+    func printCompletedResults() {
+        while nextResultToPrint < results.count, let result = results[nextResultToPrint] {
+            switch result {
+            case .success(let digest):
+                print("\(String(hexEncoding: digest))  \(paths[nextResultToPrint])")
+            case .failure(let error):
+                print("Unable to hash \(paths[nextResultToPrint]): \(error)")
+            }
+            results[nextResultToPrint] = nil
+            nextResultToPrint += 1
+        }
+    }
+
+    DispatchQueue.concurrentPerform(iterations: max(1, min(jobs, paths.count))) { _ in
+        while true {
+            lock.lock()
+            let index = nextPath
+            nextPath += 1
+            lock.unlock()
+            guard index < paths.count else {
+                return
+            }
+
+            let result = Result { try algorithm.hash(fileAtPath: paths[index]) }
+
+            lock.lock()
+            results[index] = result
+            printCompletedResults()
+            lock.unlock()
+        }
+    }
+}
+
+/// Reports how quickly each algorithm hashes data that is already in memory, using `jobs` threads.
 @available(macOS 10.15, iOS 13, watchOS 6, tvOS 13, macCatalyst 13, visionOS 1.0, *)
-func processInputs(_ handles: [String: FileHandle], algorithm: SupportedHashFunction) {
-    for (name, fh) in handles {
-        let result = algorithm.hashLoop(from: fh)
-        print("\(String(hexEncoding: result))  \(name)")
+func benchmark(jobs: Int) {
+    let bufferSize = 64 << 20
+    let iterationsPerJob = 8
+    let buffer = UnsafeMutableRawBufferPointer.allocate(byteCount: bufferSize, alignment: 64)
+    defer { buffer.deallocate() }
+    buffer.initializeMemory(as: UInt8.self, repeating: 0x2A)
+
+    for (name, algorithm) in SupportedHashFunction.allCases {
+        let start = DispatchTime.now()
+        DispatchQueue.concurrentPerform(iterations: jobs) { _ in
+            for _ in 0..<iterationsPerJob {
+                _ = algorithm.hash(UnsafeRawBufferPointer(buffer))
+            }
+        }
+        let seconds = Double(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds) / 1_000_000_000
+        let gigabytes = Double(bufferSize * iterationsPerJob * jobs) / 1_000_000_000
+        print("\(name): \(String(format: "%.2f", gigabytes / seconds)) GB/s with \(jobs) job(s)")
     }
 }
 
@@ -101,7 +204,9 @@ func processInputs(_ handles: [String: FileHandle], algorithm: SupportedHashFunc
 func main() {
     var arguments = CommandLine.arguments.dropFirst()
     var algorithm = SupportedHashFunction.sha256  // Default to sha256
-    var files = [String: FileHandle]()
+    var jobs = ProcessInfo.processInfo.activeProcessorCount
+    var runBenchmark = false
+    var files = [String]()
 
     // First get the flags.
     flagsLoop: while let first = arguments.first, first.starts(with: "-") {
@@ -115,12 +220,22 @@ func main() {
             }
             algorithm = newAlgorithm
 
+        case "-j", "--jobs":
+            guard let flag = arguments.popFirst(), let newJobs = Int(flag), newJobs > 0 else {
+                print("The number of jobs must be a positive integer.")
+                return
+            }
+            jobs = newJobs
+
+        case "--bench":
+            runBenchmark = true
+
         case "--":
             break flagsLoop  // Everything left is files.
 
         case "-":
             // Whoops, this is a file. We need to read from stdin. Ignore any further flags, the rest of the arguments are files.
-            files["-"] = FileHandle.standardInput
+            files.append("-")
             break flagsLoop
 
         default:
@@ -129,23 +244,28 @@ func main() {
         }
     }
 
+    if runBenchmark {
+        benchmark(jobs: jobs)
+        return
+    }
+
     // Now the files.
     while let first = arguments.popFirst() {
-        // We assume this is a path.
-        guard let fh = FileHandle(forReadingAtPath: first) else {
+        // We assume this is a path. Files are opened as they are hashed, so check them all up front.
+        guard first == "-" || FileManager.default.isReadableFile(atPath: first) else {
             print("Unable to open \(first)")
             return
         }
 
-        files[first] = fh
+        files.append(first)
     }
 
     if files.count == 0 {
         // No flags. We assume that means stdin.
-        files["-"] = FileHandle.standardInput
+        files.append("-")
     }
 
-    processInputs(files, algorithm: algorithm)
+    processInputs(files, algorithm: algorithm, jobs: jobs)
 }
 
 
@@ -12,6 +12,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+import Dispatch
 import XCTest
 
 @testable import CryptoBoringWrapper
@@ -330,4 +331,42 @@ final class ArbitraryPrecisionIntegerTests: XCTestCase {
             }
         }
     }
+
+    func testMutatingArithmeticLeavesCopiesAlone() {
+        let original = ArbitraryPrecisionInteger(12)
+
+        var sum = original
+        sum += 5
+        var difference = original
+        difference -= 20
+        var product = original
+        product *= original
+        var doubled = original
+        doubled += doubled
+
+        XCTAssertEqual(original, 12)
+        XCTAssertEqual(sum, 17)
+        XCTAssertEqual(difference, -8)
+        XCTAssertEqual(product, 144)
+        XCTAssertEqual(doubled, 24)
+
+        // Once the storage is no longer shared, further mutation happens in place.
+        product *= product
+        product -= 1
+        XCTAssertEqual(product, 20735)
+        XCTAssertEqual(original, 12)
+    }
+
+    func testArithmeticOnManyThreads() {
+        // Each thread uses its own scratch context, so this checks that they don't interfere.
+        DispatchQueue.concurrentPerform(iterations: 8) { thread in
+            let modulus = ArbitraryPrecisionInteger(1_000_003)
+            var value = ArbitraryPrecisionInteger(integerLiteral: Int64(thread + 2))
+            for _ in 0..<1000 {
+                value = try! value.mul(value, modulo: modulus)
+                XCTAssertEqual(try! value.modulo(modulus), value)
+            }
+            XCTAssertEqual(try! ArbitraryPrecisionInteger.gcd(value, modulus), 1)
+        }
+    }
 }
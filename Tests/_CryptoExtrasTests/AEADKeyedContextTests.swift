@@ -0,0 +1,381 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Dispatch
+import Foundation
+import _CryptoExtras
+import XCTest
+
+final class AEADKeyedContextTests: XCTestCase {
+    func testAESGCMKeyedContextMatchesOneShot() throws {
+        for keySize in [SymmetricKeySize.bits128, .bits192, .bits256] {
+            let key = SymmetricKey(size: keySize)
+            let context = try AES.GCM._KeyedContext(key: key)
+            let nonce = AES.GCM.Nonce()
+            let message = Array("Some message to seal".utf8)
+            let authenticatedData = Array("Some authenticated data".utf8)
+
+            let (contiguousMessage, discontiguousMessage) = message.asDataProtocols()
+            let (contiguousAD, discontiguousAD) = authenticatedData.asDataProtocols()
+
+            let expected = try AES.GCM.seal(message, using: key, nonce: nonce, authenticating: authenticatedData)
+            let sealed = try context.seal(contiguousMessage, nonce: nonce, authenticating: contiguousAD)
+            let sealedDiscontiguous = try context.seal(discontiguousMessage, nonce: nonce, authenticating: discontiguousAD)
+            XCTAssertEqual(sealed.combined, expected.combined)
+            XCTAssertEqual(sealedDiscontiguous.combined, expected.combined)
+
+            XCTAssertEqual(try context.open(expected, authenticating: discontiguousAD), Data(message))
+            XCTAssertEqual(try AES.GCM.open(sealed, using: key, authenticating: authenticatedData), Data(message))
+            XCTAssertThrowsError(try context.open(expected))
+        }
+    }
+
+    func testAESGCMKeyedContextWithoutAuthenticatedData() throws {
+        let key = SymmetricKey(size: .bits256)
+        let context = try AES.GCM._KeyedContext(key: key)
+        let message = Data("Some message to seal".utf8)
+
+        // Reuse the context for several messages, which is the entire point of it.
+        for _ in 0..<8 {
+            let sealed = try context.seal(message)
+            XCTAssertEqual(try AES.GCM.open(sealed, using: key), message)
+            XCTAssertEqual(try context.open(sealed), message)
+        }
+    }
+
+    func testAESGCMKeyedContextRejectsWrongKey() throws {
+        let context = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+        let otherKey = SymmetricKey(size: .bits256)
+        let sealed = try AES.GCM.seal(Data("Some message to seal".utf8), using: otherKey)
+        XCTAssertThrowsError(try context.open(sealed))
+    }
+
+    func testAESGCMKeyedContextRejectsInvalidKeySizes() {
+        XCTAssertThrowsError(try AES.GCM._KeyedContext(key: SymmetricKey(size: .init(bitCount: 64)))) { error in
+            guard case CryptoKitError.incorrectKeySize = error else { return XCTFail("Unexpected error: \(error)") }
+        }
+    }
+
+    func testChaChaPolyKeyedContextMatchesOneShot() throws {
+        let key = SymmetricKey(size: .bits256)
+        let context = try ChaChaPoly._KeyedContext(key: key)
+        let nonce = ChaChaPoly.Nonce()
+        let message = Array("Some message to seal".utf8)
+        let authenticatedData = Array("Some authenticated data".utf8)
+
+        let (contiguousMessage, discontiguousMessage) = message.asDataProtocols()
+        let (contiguousAD, discontiguousAD) = authenticatedData.asDataProtocols()
+
+        let expected = try ChaChaPoly.seal(message, using: key, nonce: nonce, authenticating: authenticatedData)
+        let sealed = try context.seal(contiguousMessage, nonce: nonce, authenticating: contiguousAD)
+        let sealedDiscontiguous = try context.seal(discontiguousMessage, nonce: nonce, authenticating: discontiguousAD)
+        XCTAssertEqual(sealed.combined, expected.combined)
+        XCTAssertEqual(sealedDiscontiguous.combined, expected.combined)
+
+        XCTAssertEqual(try context.open(expected, authenticating: discontiguousAD), Data(message))
+        XCTAssertEqual(try ChaChaPoly.open(sealed, using: key, authenticating: authenticatedData), Data(message))
+        XCTAssertThrowsError(try context.open(expected))
+    }
+
+    func testChaChaPolyKeyedContextRejectsInvalidKeySizes() {
+        XCTAssertThrowsError(try ChaChaPoly._KeyedContext(key: SymmetricKey(size: .bits128))) { error in
+            guard case CryptoKitError.incorrectKeySize = error else { return XCTFail("Unexpected error: \(error)") }
+        }
+    }
+
+    func testAESGCMKeyedContextSealAndOpenIntoBuffers() throws {
+        let key = SymmetricKey(size: .bits256)
+        let context = try AES.GCM._KeyedContext(key: key)
+        let nonce = AES.GCM.Nonce()
+        let message = Array("Some message to seal".utf8)
+        let authenticatedData = Array("Some authenticated data".utf8)
+        let expected = try AES.GCM.seal(message, using: key, nonce: nonce, authenticating: authenticatedData)
+        let expectedCiphertextAndTag = expected.ciphertext + expected.tag
+
+        var buffer = [UInt8](repeating: 0, count: message.count + 16)
+        let sealedCount = try buffer.withUnsafeMutableBytes {
+            try context.seal(message, nonce: nonce, authenticating: authenticatedData, into: $0)
+        }
+        XCTAssertEqual(sealedCount, message.count + 16)
+        XCTAssertEqual(Data(buffer), expectedCiphertextAndTag)
+
+        // Opening in place must also work.
+        let openedCount = try buffer.withUnsafeMutableBytes {
+            try context.open(UnsafeRawBufferPointer($0), nonce: nonce, authenticating: authenticatedData, into: $0)
+        }
+        XCTAssertEqual(openedCount, message.count)
+        XCTAssertEqual(Array(buffer.prefix(openedCount)), message)
+
+        var appendedBytes: [UInt8] = [0xFF]
+        try context.seal(message, nonce: nonce, authenticating: authenticatedData, appendingTo: &appendedBytes)
+        XCTAssertEqual(Data(appendedBytes.dropFirst()), expectedCiphertextAndTag)
+
+        var appendedData = Data([0xFF])
+        try context.seal(message, nonce: nonce, authenticating: authenticatedData, appendingTo: &appendedData)
+        XCTAssertEqual(appendedData.dropFirst(), expectedCiphertextAndTag)
+
+        var openedBytes: [UInt8] = [0xFF]
+        try context.open(expectedCiphertextAndTag, nonce: nonce, authenticating: authenticatedData, appendingTo: &openedBytes)
+        XCTAssertEqual(openedBytes, [0xFF] + message)
+
+        var openedData = Data([0xFF])
+        try context.open(expectedCiphertextAndTag, nonce: nonce, authenticating: authenticatedData, appendingTo: &openedData)
+        XCTAssertEqual(openedData, Data([0xFF] + message))
+    }
+
+    func testAESGCMKeyedContextIntoBuffersRejectsBadInput() throws {
+        let context = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+        let nonce = AES.GCM.Nonce()
+        let message = Array("Some message to seal".utf8)
+
+        var tooSmall = [UInt8](repeating: 0, count: message.count + 15)
+        XCTAssertThrowsError(
+            try tooSmall.withUnsafeMutableBytes {
+                try context.seal(message, nonce: nonce, authenticating: Data(), into: $0)
+            }
+        ) { error in
+            guard case CryptoKitError.incorrectParameterSize = error else { return XCTFail("Unexpected error: \(error)") }
+        }
+
+        var sealed: [UInt8] = []
+        try context.seal(message, nonce: nonce, authenticating: Data(), appendingTo: &sealed)
+        sealed[sealed.count - 1] ^= 1
+
+        var opened = Data([0xFF])
+        XCTAssertThrowsError(try context.open(sealed, nonce: nonce, authenticating: Data(), appendingTo: &opened))
+        XCTAssertEqual(opened, Data([0xFF]))
+
+        XCTAssertThrowsError(
+            try context.open(sealed.prefix(15), nonce: nonce, authenticating: Data(), appendingTo: &opened)
+        ) { error in
+            guard case CryptoKitError.incorrectParameterSize = error else { return XCTFail("Unexpected error: \(error)") }
+        }
+    }
+
+    func testChaChaPolyKeyedContextSealAndOpenIntoBuffers() throws {
+        let key = SymmetricKey(size: .bits256)
+        let context = try ChaChaPoly._KeyedContext(key: key)
+        let nonce = ChaChaPoly.Nonce()
+        let message = Array("Some message to seal".utf8)
+        let (_, discontiguousMessage) = message.asDataProtocols()
+        let expected = try ChaChaPoly.seal(message, using: key, nonce: nonce)
+        let expectedCiphertextAndTag = expected.ciphertext + expected.tag
+
+        var sealed = Data()
+        try context.seal(discontiguousMessage, nonce: nonce, authenticating: Data(), appendingTo: &sealed)
+        XCTAssertEqual(sealed, expectedCiphertextAndTag)
+
+        var opened = [UInt8](repeating: 0, count: message.count)
+        let openedCount = try opened.withUnsafeMutableBytes {
+            try context.open(sealed, nonce: nonce, authenticating: Data(), into: $0)
+        }
+        XCTAssertEqual(openedCount, message.count)
+        XCTAssertEqual(opened, message)
+    }
+
+    func testKeyedContextsHandleManyOddlySizedRegions() throws {
+        // These sizes straddle the 16 byte GHASH and 64 byte ChaCha20 block boundaries in every direction.
+        let regionSizes = [1, 7, 63, 64, 65, 0, 200, 3, 16, 17]
+        let message = (0..<regionSizes.reduce(0, +)).map { UInt8(truncatingIfNeeded: $0) }
+        let authenticatedData = Array("Some authenticated data that is longer than a block".utf8)
+        let discontiguousMessage = message.asDispatchData(regionSizes: regionSizes)
+        let discontiguousAD = authenticatedData.asDispatchData(regionSizes: [5, 0, 11, authenticatedData.count - 16])
+        XCTAssertGreaterThan(discontiguousMessage.regions.count, 2)
+
+        let aesKey = SymmetricKey(size: .bits128)
+        let aesContext = try AES.GCM._KeyedContext(key: aesKey)
+        let aesNonce = AES.GCM.Nonce()
+        let aesExpected = try AES.GCM.seal(message, using: aesKey, nonce: aesNonce, authenticating: authenticatedData)
+        let aesSealed = try aesContext.seal(discontiguousMessage, nonce: aesNonce, authenticating: discontiguousAD)
+        XCTAssertEqual(aesSealed.combined, aesExpected.combined)
+        XCTAssertEqual(try aesContext.open(aesExpected, authenticating: discontiguousAD), Data(message))
+
+        let aesCiphertextAndTag = Array(aesExpected.ciphertext + aesExpected.tag)
+        var aesOpened: [UInt8] = []
+        try aesContext.open(
+            // The tag straddles the last two regions.
+            aesCiphertextAndTag.asDispatchData(regionSizes: regionSizes + [10, 6]),
+            nonce: aesNonce,
+            authenticating: discontiguousAD,
+            appendingTo: &aesOpened
+        )
+        XCTAssertEqual(aesOpened, message)
+
+        // A forged message must fail the same way whether or not it is contiguous.
+        var aesForged = aesCiphertextAndTag
+        aesForged[aesForged.count - 1] ^= 1
+        let aesContiguousError = self.thrownError {
+            try aesContext.open(aesForged, nonce: aesNonce, authenticating: authenticatedData, appendingTo: &aesOpened)
+        }
+        let aesDiscontiguousError = self.thrownError {
+            try aesContext.open(
+                aesForged.asDispatchData(regionSizes: regionSizes + [16]),
+                nonce: aesNonce,
+                authenticating: discontiguousAD,
+                appendingTo: &aesOpened
+            )
+        }
+        XCTAssertNotNil(aesContiguousError)
+        XCTAssertEqual(aesDiscontiguousError, aesContiguousError)
+        XCTAssertEqual(aesOpened, message)
+
+        let chaChaKey = SymmetricKey(size: .bits256)
+        let chaChaContext = try ChaChaPoly._KeyedContext(key: chaChaKey)
+        let chaChaNonce = ChaChaPoly.Nonce()
+        let chaChaExpected = try ChaChaPoly.seal(
+            message,
+            using: chaChaKey,
+            nonce: chaChaNonce,
+            authenticating: authenticatedData
+        )
+        let chaChaSealed = try chaChaContext.seal(
+            discontiguousMessage,
+            nonce: chaChaNonce,
+            authenticating: discontiguousAD
+        )
+        XCTAssertEqual(chaChaSealed.combined, chaChaExpected.combined)
+        XCTAssertEqual(try chaChaContext.open(chaChaExpected, authenticating: discontiguousAD), Data(message))
+
+        var chaChaSealedBytes: [UInt8] = []
+        try chaChaContext.seal(
+            discontiguousMessage,
+            nonce: chaChaNonce,
+            authenticating: discontiguousAD,
+            appendingTo: &chaChaSealedBytes
+        )
+        XCTAssertEqual(Data(chaChaSealedBytes), chaChaExpected.ciphertext + chaChaExpected.tag)
+
+        // A forged message must fail the same way whether or not it is contiguous.
+        chaChaSealedBytes[chaChaSealedBytes.count - 1] ^= 1
+        var chaChaOpened: [UInt8] = [0xFF]
+        let chaChaContiguousError = self.thrownError {
+            try chaChaContext.open(
+                chaChaSealedBytes,
+                nonce: chaChaNonce,
+                authenticating: authenticatedData,
+                appendingTo: &chaChaOpened
+            )
+        }
+        let chaChaDiscontiguousError = self.thrownError {
+            try chaChaContext.open(
+                chaChaSealedBytes.asDispatchData(regionSizes: regionSizes + [16]),
+                nonce: chaChaNonce,
+                authenticating: discontiguousAD,
+                appendingTo: &chaChaOpened
+            )
+        }
+        XCTAssertNotNil(chaChaContiguousError)
+        XCTAssertEqual(chaChaDiscontiguousError, chaChaContiguousError)
+        XCTAssertEqual(chaChaOpened, [0xFF])
+    }
+
+    func testKeyedContextsZeroOutputWhenAuthenticationFails() throws {
+        let message = (0..<100).map { UInt8(truncatingIfNeeded: $0) }
+        let regionSizes = [1, 63, 20, 16, 16]
+
+        let aesContext = try AES.GCM._KeyedContext(key: SymmetricKey(size: .bits256))
+        let aesNonce = AES.GCM.Nonce()
+        var aesForged: [UInt8] = []
+        try aesContext.seal(message, nonce: aesNonce, authenticating: Data(), appendingTo: &aesForged)
+        aesForged[aesForged.count - 1] ^= 1
+
+        let chaChaContext = try ChaChaPoly._KeyedContext(key: SymmetricKey(size: .bits256))
+        let chaChaNonce = ChaChaPoly.Nonce()
+        var chaChaForged: [UInt8] = []
+        try chaChaContext.seal(message, nonce: chaChaNonce, authenticating: Data(), appendingTo: &chaChaForged)
+        chaChaForged[chaChaForged.count - 1] ^= 1
+
+        self.checkOutputZeroed(byteCount: message.count) {
+            try aesContext.open(aesForged, nonce: aesNonce, authenticating: Data(), into: $0)
+        }
+        self.checkOutputZeroed(byteCount: message.count) {
+            try aesContext.open(
+                aesForged.asDispatchData(regionSizes: regionSizes),
+                nonce: aesNonce,
+                authenticating: Data(),
+                into: $0
+            )
+        }
+        self.checkOutputZeroed(byteCount: message.count) {
+            try chaChaContext.open(chaChaForged, nonce: chaChaNonce, authenticating: Data(), into: $0)
+        }
+        self.checkOutputZeroed(byteCount: message.count) {
+            try chaChaContext.open(
+                chaChaForged.asDispatchData(regionSizes: regionSizes),
+                nonce: chaChaNonce,
+                authenticating: Data(),
+                into: $0
+            )
+        }
+
+        // Opening in place must zero the ciphertext the plaintext was written over.
+        var inPlace = aesForged
+        XCTAssertThrowsError(
+            try inPlace.withUnsafeMutableBytes {
+                try aesContext.open(UnsafeRawBufferPointer($0), nonce: aesNonce, authenticating: Data(), into: $0)
+            }
+        )
+        XCTAssertEqual(Array(inPlace.prefix(message.count)), [UInt8](repeating: 0, count: message.count))
+
+        // The appending variants leave `output` exactly as it was.
+        var appendedBytes: [UInt8] = [0xFF]
+        XCTAssertThrowsError(
+            try chaChaContext.open(
+                chaChaForged,
+                nonce: chaChaNonce,
+                authenticating: Data(),
+                appendingTo: &appendedBytes
+            )
+        )
+        XCTAssertEqual(appendedBytes, [0xFF])
+
+        var appendedData = Data([0xFF])
+        XCTAssertThrowsError(
+            try aesContext.open(
+                aesForged.asDispatchData(regionSizes: regionSizes),
+                nonce: aesNonce,
+                authenticating: Data(),
+                appendingTo: &appendedData
+            )
+        )
+        XCTAssertEqual(appendedData, Data([0xFF]))
+    }
+
+    /// Returns the error `body` throws, or `nil` if it doesn't throw one.
+    private func thrownError(_ body: () throws -> Void) -> CryptoKitError? {
+        do {
+            try body()
+            return nil
+        } catch {
+            return error as? CryptoKitError
+        }
+    }
+}
+
+extension Array where Element == UInt8 {
+    /// Splits the array into a `DispatchData` made of regions of the given sizes, which must add up to its count.
+    fileprivate func asDispatchData(regionSizes: [Int]) -> DispatchData {
+        precondition(regionSizes.reduce(0, +) == self.count)
+        return self.withUnsafeBytes { bytesPointer in
+            var data = DispatchData.empty
+            var offset = 0
+            for size in regionSizes where size > 0 {
+                data.append(DispatchData(bytes: UnsafeRawBufferPointer(rebasing: bytesPointer[offset..<(offset + size)])))
+                offset += size
+            }
+            return data
+        }
+    }
+}
@@ -0,0 +1,274 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+import _CryptoExtras
+import XCTest
+
+final class AEADStreamingTests: XCTestCase {
+    // These sizes straddle the 16 byte GHASH and 64 byte ChaCha20 block boundaries in every direction.
+    private static let pieceSizes = [1, 7, 63, 64, 65, 0, 200, 3, 16, 17, 1000]
+
+    private static func pieces(of message: [UInt8]) -> [ArraySlice<UInt8>] {
+        var pieces: [ArraySlice<UInt8>] = []
+        var offset = 0
+        for size in Self.pieceSizes {
+            let end = min(offset + size, message.count)
+            pieces.append(message[offset..<end])
+            offset = end
+        }
+        pieces.append(message[offset...])
+        return pieces
+    }
+
+    private let message = (0..<2048).map { UInt8(truncatingIfNeeded: $0 &* 31) }
+    private let authenticatedData = Array("Some authenticated data".utf8)
+
+    func testAESGCMEncryptorMatchesOneShot() throws {
+        for keySize in [SymmetricKeySize.bits128, .bits192, .bits256] {
+            let key = SymmetricKey(size: keySize)
+            var encryptor = try AES.GCM._Encryptor(key: key, authenticating: self.authenticatedData)
+            let nonce = encryptor.nonce
+
+            var ciphertext = Data()
+            for piece in Self.pieces(of: self.message) {
+                ciphertext += try encryptor.update(piece)
+            }
+            let tag = try encryptor.finalize()
+
+            let expected = try AES.GCM.seal(self.message, using: key, nonce: nonce, authenticating: self.authenticatedData)
+            XCTAssertEqual(ciphertext, expected.ciphertext)
+            XCTAssertEqual(tag, expected.tag)
+
+            var decryptor = try AES.GCM._Decryptor(key: key, nonce: nonce, authenticating: self.authenticatedData)
+            var plaintext = Data()
+            for piece in Self.pieces(of: Array(ciphertext)) {
+                plaintext += try decryptor.update(piece)
+            }
+            try decryptor.finalize(verifying: tag)
+            XCTAssertEqual(plaintext, Data(self.message))
+        }
+    }
+
+    func testAESGCMDecryptorRejectsBadTag() throws {
+        let key = SymmetricKey(size: .bits256)
+        let sealed = try AES.GCM.seal(self.message, using: key, authenticating: self.authenticatedData)
+        var badTag = Array(sealed.tag)
+        badTag[0] ^= 1
+
+        var decryptor = try AES.GCM._Decryptor(key: key, nonce: sealed.nonce, authenticating: self.authenticatedData)
+        let unauthenticatedPlaintext = try decryptor.update(sealed.ciphertext)
+        XCTAssertEqual(unauthenticatedPlaintext, Data(self.message))
+        do {
+            try decryptor.finalize(verifying: badTag)
+            XCTFail("Opening with a bad tag succeeded")
+        } catch CryptoKitError.authenticationFailure {
+            // Expected
+        }
+    }
+
+    func testAESGCMEncryptorIntoBuffer() throws {
+        let key = SymmetricKey(size: .bits256)
+        var encryptor = try AES.GCM._Encryptor(key: key)
+        let nonce = encryptor.nonce
+
+        var ciphertext = [UInt8](repeating: 0, count: self.message.count)
+        var offset = 0
+        for piece in Self.pieces(of: self.message) {
+            offset += try ciphertext.withUnsafeMutableBytes {
+                try encryptor.update(piece, into: UnsafeMutableRawBufferPointer(rebasing: $0[offset...]))
+            }
+        }
+        XCTAssertEqual(offset, self.message.count)
+        let tag = try encryptor.finalize()
+
+        let sealedBox = try AES.GCM.SealedBox(nonce: nonce, ciphertext: ciphertext, tag: tag)
+        XCTAssertEqual(try AES.GCM.open(sealedBox, using: key), Data(self.message))
+    }
+
+    func testChaChaPolyEncryptorMatchesOneShot() throws {
+        let key = SymmetricKey(size: .bits256)
+        var encryptor = try ChaChaPoly._Encryptor(key: key, authenticating: self.authenticatedData)
+        let nonce = encryptor.nonce
+
+        var ciphertext = Data()
+        for piece in Self.pieces(of: self.message) {
+            ciphertext += try encryptor.update(piece)
+        }
+        let tag = try encryptor.finalize()
+
+        let expected = try ChaChaPoly.seal(self.message, using: key, nonce: nonce, authenticating: self.authenticatedData)
+        XCTAssertEqual(ciphertext, expected.ciphertext)
+        XCTAssertEqual(tag, expected.tag)
+
+        var decryptor = try ChaChaPoly._Decryptor(key: key, nonce: nonce, authenticating: self.authenticatedData)
+        var plaintext = Data()
+        for piece in Self.pieces(of: Array(ciphertext)) {
+            plaintext += try decryptor.update(piece)
+        }
+        try decryptor.finalize(verifying: tag)
+        XCTAssertEqual(plaintext, Data(self.message))
+
+        var badDecryptor = try ChaChaPoly._Decryptor(key: key, nonce: nonce)
+        _ = try badDecryptor.update(ciphertext)
+        do {
+            try badDecryptor.finalize(verifying: tag)
+            XCTFail("Opening without the authenticated data succeeded")
+        } catch CryptoKitError.authenticationFailure {
+            // Expected
+        }
+    }
+
+    func testStreamingRejectsInvalidKeySizes() {
+        do {
+            _ = try ChaChaPoly._Encryptor(key: SymmetricKey(size: .bits128))
+            XCTFail("Created an encryptor with a 128-bit key")
+        } catch CryptoKitError.incorrectKeySize {
+            // Expected
+        } catch {
+            XCTFail("Unexpected error: \(error)")
+        }
+
+        do {
+            _ = try AES.GCM._Decryptor(key: SymmetricKey(size: .init(bitCount: 64)), nonce: AES.GCM.Nonce())
+            XCTFail("Created a decryptor with a 64-bit key")
+        } catch CryptoKitError.incorrectKeySize {
+            // Expected
+        } catch {
+            XCTFail("Unexpected error: \(error)")
+        }
+    }
+
+    func testAESGCMSTREAMRoundTrip() throws {
+        let key = SymmetricKey(size: .bits256)
+        let chunks = Self.pieces(of: self.message)
+
+        var sealer = try AES.GCM._STREAMSealer(key: key, authenticating: self.authenticatedData)
+        var sealedChunks: [Data] = []
+        for (index, chunk) in chunks.enumerated() {
+            sealedChunks.append(try sealer.seal(chunk, isFinal: index == chunks.count - 1))
+        }
+        XCTAssertEqual(sealedChunks.map { $0.count }, chunks.map { $0.count + 16 })
+
+        let header = sealer.header
+        XCTAssertEqual(header.count, 39)
+        var opener = try AES.GCM._STREAMOpener(
+            key: key,
+            header: header,
+            authenticating: self.authenticatedData
+        )
+        var plaintext = Data()
+        var finishedBeforeEnd = false
+        for (index, sealedChunk) in sealedChunks.enumerated() {
+            finishedBeforeEnd = finishedBeforeEnd || opener.isFinished
+            plaintext += try opener.open(sealedChunk, isFinal: index == sealedChunks.count - 1)
+        }
+        let finished = opener.isFinished
+        XCTAssertFalse(finishedBeforeEnd)
+        XCTAssertTrue(finished)
+        XCTAssertEqual(plaintext, Data(self.message))
+
+        // Nothing may follow the final chunk.
+        do {
+            _ = try sealer.seal(Data())
+            XCTFail("Sealed a chunk after the final one")
+        } catch CryptoKitError.invalidParameter {
+            // Expected
+        }
+        do {
+            _ = try opener.open(sealedChunks[0])
+            XCTFail("Opened a chunk after the final one")
+        } catch CryptoKitError.invalidParameter {
+            // Expected
+        }
+    }
+
+    func testChaChaPolySTREAMDetectsTamperedStreams() throws {
+        let key = SymmetricKey(size: .bits256)
+        var sealer = try ChaChaPoly._STREAMSealer(key: key)
+        let first = try sealer.seal(Data("first".utf8))
+        let second = try sealer.seal(Data("second".utf8))
+        let last = try sealer.seal(Data("last".utf8), isFinal: true)
+
+        let header = sealer.header
+
+        // In order, it opens.
+        var opener = try ChaChaPoly._STREAMOpener(key: key, header: header)
+        var opened = try opener.open(first)
+        opened += try opener.open(second)
+        opened += try opener.open(last, isFinal: true)
+        XCTAssertEqual(opened, Data("firstsecondlast".utf8))
+
+        // Reordered chunks are rejected.
+        var reorderedOpener = try ChaChaPoly._STREAMOpener(key: key, header: header)
+        do {
+            _ = try reorderedOpener.open(second)
+            XCTFail("Opened a reordered chunk")
+        } catch {}
+
+        // So is a stream truncated after a chunk that wasn't the last.
+        var truncatedOpener = try ChaChaPoly._STREAMOpener(key: key, header: header)
+        _ = try truncatedOpener.open(first)
+        do {
+            _ = try truncatedOpener.open(second, isFinal: true)
+            XCTFail("Opened a truncated stream")
+        } catch {}
+
+        // And the last chunk presented as if more followed it.
+        var extendedOpener = try ChaChaPoly._STREAMOpener(key: key, header: header)
+        _ = try extendedOpener.open(first)
+        _ = try extendedOpener.open(second)
+        do {
+            _ = try extendedOpener.open(last)
+            XCTFail("Opened the final chunk as a non-final one")
+        } catch {}
+    }
+
+    func testSTREAMSealsEachStreamUnderItsOwnSubkey() throws {
+        let key = SymmetricKey(size: .bits128)
+        var sealer = try AES.GCM._STREAMSealer(key: key)
+        let chunk = try sealer.seal(Data("chunk".utf8), isFinal: true)
+        let header = sealer.header
+        let otherHeader = try AES.GCM._STREAMSealer(key: key).header
+        XCTAssertNotEqual(header, otherHeader)
+
+        // The chunk isn't sealed under the key itself, even with the nonce STREAM used for it.
+        let nonce = try AES.GCM.Nonce(data: header.suffix(7) + [0, 0, 0, 0, 1])
+        let sealedBox = try AES.GCM.SealedBox(nonce: nonce, ciphertext: chunk.dropLast(16), tag: chunk.suffix(16))
+        XCTAssertThrowsError(try AES.GCM.open(sealedBox, using: key))
+
+        // Nor does it open under another stream's header.
+        var otherOpener = try AES.GCM._STREAMOpener(key: key, header: otherHeader)
+        do {
+            _ = try otherOpener.open(chunk, isFinal: true)
+            XCTFail("Opened a chunk under another stream's header")
+        } catch {}
+
+        var opener = try AES.GCM._STREAMOpener(key: key, header: header)
+        let opened = try opener.open(chunk, isFinal: true)
+        XCTAssertEqual(opened, Data("chunk".utf8))
+    }
+
+    func testSTREAMRejectsBadHeader() {
+        do {
+            _ = try AES.GCM._STREAMOpener(key: SymmetricKey(size: .bits128), header: [UInt8](repeating: 0, count: 7))
+            XCTFail("Created an opener with a 7-byte header")
+        } catch CryptoKitError.incorrectParameterSize {
+            // Expected
+        } catch {
+            XCTFail("Unexpected error: \(error)")
+        }
+    }
+}
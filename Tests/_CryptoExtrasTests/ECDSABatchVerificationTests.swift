@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+import _CryptoExtras
+import XCTest
+
+final class ECDSABatchVerificationTests: XCTestCase {
+    private typealias BatchItem = (
+        signature: P256.Signing.ECDSASignature, data: [UInt8], publicKey: P256.Signing.PublicKey
+    )
+
+    /// Makes `count` signatures, shared out between `keyCount` keys in interleaved order.
+    private func makeBatch(count: Int, keyCount: Int) throws -> [BatchItem] {
+        let keys = (0..<keyCount).map { _ in P256.Signing.PrivateKey() }
+        return try (0..<count).map { index in
+            let key = keys[index % keyCount]
+            let message = (0..<(index % 100)).map { UInt8(truncatingIfNeeded: $0 &* 13 &+ index) }
+            return (try key.signature(for: message), message, key.publicKey)
+        }
+    }
+
+    private func modifying(
+        _ signature: P256.Signing.ECDSASignature,
+        _ body: (inout Data) -> Void
+    ) throws -> P256.Signing.ECDSASignature {
+        var rawRepresentation = signature.rawRepresentation
+        body(&rawRepresentation)
+        return try P256.Signing.ECDSASignature(rawRepresentation: rawRepresentation)
+    }
+
+    private func checkMatchesIndividualVerification(
+        _ batch: [BatchItem],
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) {
+        let expected = batch.map { $0.publicKey.isValidSignature($0.signature, for: $0.data) }
+        XCTAssertEqual(P256.Signing.PublicKey._areValidSignatures(batch), expected, file: file, line: line)
+    }
+
+    func testValidBatches() throws {
+        // Keys with fewer than six signatures don't get a table, and batches of 128 or more may be split across
+        // threads, so these cover every path.
+        for (count, keyCount) in [(0, 1), (1, 1), (5, 1), (6, 1), (40, 3), (40, 40), (300, 2), (300, 300)] {
+            let batch = try self.makeBatch(count: count, keyCount: keyCount)
+            XCTAssertEqual(
+                P256.Signing.PublicKey._areValidSignatures(batch),
+                Array(repeating: true, count: count)
+            )
+        }
+    }
+
+    func testInvalidSignaturesAreIdentified() throws {
+        for keyCount in [1, 40] {
+            let batch = try self.makeBatch(count: 40, keyCount: keyCount)
+
+            var tampered = batch
+            tampered[3].data.append(0)
+            tampered[21].publicKey = P256.Signing.PrivateKey().publicKey
+            (tampered[30].signature, tampered[31].signature) = (tampered[31].signature, tampered[30].signature)
+            // A flipped bit in r, a flipped bit in s, an s of zero, and an s that isn't reduced.
+            tampered[10].signature = try self.modifying(batch[10].signature) { $0[5] ^= 1 }
+            tampered[17].signature = try self.modifying(batch[17].signature) { $0[40] ^= 1 }
+            tampered[35].signature = try self.modifying(batch[35].signature) {
+                $0.replaceSubrange(32..<64, with: repeatElement(0, count: 32))
+            }
+            tampered[39].signature = try self.modifying(batch[39].signature) {
+                $0.replaceSubrange(32..<64, with: repeatElement(0xFF, count: 32))
+            }
+
+            let results = P256.Signing.PublicKey._areValidSignatures(tampered)
+            XCTAssertEqual(
+                results.indices.filter { !results[$0] },
+                [3, 10, 17, 21, 30, 31, 35, 39]
+            )
+            self.checkMatchesIndividualVerification(tampered)
+        }
+    }
+
+    func testDiscontiguousInputs() throws {
+        let batch = try self.makeBatch(count: 8, keyCount: 2)
+        let discontiguous = batch.map { item in
+            (signature: item.signature, data: item.data.asDataProtocols().discontiguous, publicKey: item.publicKey)
+        }
+        XCTAssertEqual(
+            P256.Signing.PublicKey._areValidSignatures(discontiguous),
+            Array(repeating: true, count: 8)
+        )
+    }
+}
@@ -37,6 +37,7 @@ final class VOPRFAPITests: XCTestCase {
     func testVectors() throws {
         try testVectorsVOPRF(suite: .P384_SHA384_VORPF)
         try testVectorsPRF(suite: .P384_SHA384_VORPF)
+        try testVectorsBatchVOPRF(suite: .P384_SHA384_VORPF)
     }
 
     func testVectorsVOPRF(suite: OPRFSuite) throws {
@@ -89,6 +90,45 @@ final class VOPRFAPITests: XCTestCase {
         }
     }
 
+    func testVectorsBatchVOPRF(suite: OPRFSuite) throws {
+        for vector in suite.vectors.filter({ $0.Batch > 1 }) {
+            let privateKey = try P384._VOPRF.PrivateKey(rawRepresentation: Data(hexString: suite.skSm))
+            let publicKey = privateKey.publicKey
+
+            // Batched vectors list one comma-separated value per element.
+            let inputs = try vector.Input.split(separator: ",").map { try Data(hexString: String($0)) }
+            let blinds = try vector.Blind.split(separator: ",").map {
+                try P384._VOPRF.H2G.G.Scalar(bytes: Data(hexString: String($0)))
+            }
+            XCTAssertEqual(inputs.count, vector.Batch)
+            let blindedInputs = try zip(inputs, blinds).map { try publicKey.blind($0, with: $1) }
+            XCTAssertEqual(
+                blindedInputs.map { $0.blindedElement.oprfRepresentation.hexString }.joined(separator: ","),
+                vector.BlindedElement
+            )
+
+            let fixedProofScalar = try P384._VOPRF.H2G.G.Scalar(bytes: Data(hexString: vector.Proof!.r))
+            let batchBlindEvaluation = try privateKey.evaluate(
+                batch: blindedInputs.map { $0.blindedElement },
+                using: fixedProofScalar
+            )
+            XCTAssertEqual(
+                batchBlindEvaluation.evaluatedElements.map { $0.oprfRepresentation.hexString }.joined(separator: ","),
+                vector.EvaluationElement
+            )
+            XCTAssertEqual(batchBlindEvaluation.proof.rawRepresentation.hexString, vector.Proof?.proof)
+
+            let deserialized = try P384._VOPRF.BatchBlindEvaluation(
+                rawRepresentation: batchBlindEvaluation.rawRepresentation
+            )
+            let outputs = try publicKey.finalize(batch: blindedInputs, using: deserialized)
+            XCTAssertEqual(outputs.map { $0.hexString }.joined(separator: ","), vector.Output)
+
+            // The proof covers the whole batch, so it doesn't verify against a reordered batch.
+            XCTAssertThrowsError(try publicKey.finalize(batch: Array(blindedInputs.reversed()), using: deserialized))
+        }
+    }
+
     func testVectorsPRF(suite: OPRFSuite) throws {
         for vector in suite.vectors.filter({ $0.Batch == 1 }) {
             // [Server] Create the key-pair.
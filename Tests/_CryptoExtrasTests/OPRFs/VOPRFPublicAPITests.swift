@@ -50,6 +50,29 @@ final class VOPRFPublicAPITests: XCTestCase {
         let _: Data = try publicKey.finalize(blindedInput, using: deserializedBlindEvaluation)
     }
 
+    func testEndToEndBatchVOPRF() throws {
+        let privateKey = P384._VOPRF.PrivateKey()
+        let publicKey = privateKey.publicKey
+
+        // [Client] Blind several private inputs and send all the blinded elements to the server at once.
+        let privateInputs = (0..<5).map { Data("This is some input data \($0)".utf8) }
+        let blindedInputs = try privateInputs.map { try publicKey.blind($0) }
+
+        // [Server] Blind evaluate the whole batch, with one proof covering every evaluated element.
+        let batchBlindEvaluation = try privateKey.evaluate(batch: blindedInputs.map { $0.blindedElement })
+        XCTAssertEqual(batchBlindEvaluation.evaluatedElements.count, privateInputs.count)
+
+        // [Server -> Client] Send the serialized batch blind evaluation.
+        let deserialized = try P384._VOPRF.BatchBlindEvaluation(rawRepresentation: batchBlindEvaluation.rawRepresentation)
+
+        // [Client] Finalize the batch, which matches finalizing each input with the unbatched operations.
+        let outputs = try publicKey.finalize(batch: blindedInputs, using: deserialized)
+        XCTAssertEqual(outputs, try privateInputs.map { try privateKey.evaluate($0) })
+
+        XCTAssertThrowsError(try privateKey.evaluate(batch: []))
+        XCTAssertThrowsError(try publicKey.finalize(batch: Array(blindedInputs.dropLast()), using: deserialized))
+    }
+
     func testAccessToEvaluatedElementAndProof() throws {
         /// In RFC 9497, the `BlindEvaluate` routine returns both `evaluatedElement` and `proof`, which are both later
         /// provided to `Finalize`.
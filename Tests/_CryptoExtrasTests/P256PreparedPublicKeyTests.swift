@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+import _CryptoExtras
+import XCTest
+
+final class P256PreparedPublicKeyTests: XCTestCase {
+    func testVerificationMatchesPublicKey() throws {
+        let privateKey = P256.Signing.PrivateKey()
+        let preparedKey = try P256.Signing._PreparedPublicKey(privateKey.publicKey)
+        let otherKey = P256.Signing.PrivateKey()
+
+        for length in [0, 1, 64, 1000] {
+            let message = (0..<length).map { UInt8(truncatingIfNeeded: $0 &* 7) }
+            let signature = try privateKey.signature(for: message)
+            XCTAssertTrue(preparedKey.isValidSignature(signature, for: message))
+            XCTAssertTrue(preparedKey.isValidSignature(signature, for: SHA256.hash(data: message)))
+            XCTAssertTrue(preparedKey.isValidSignature(signature, for: message.asDataProtocols().discontiguous))
+
+            var tamperedSignature = signature.rawRepresentation
+            tamperedSignature[7] ^= 1
+            let candidates = [
+                (try P256.Signing.ECDSASignature(rawRepresentation: tamperedSignature), message),
+                (signature, message + [0]),
+                (try otherKey.signature(for: message), message),
+            ]
+            for (candidate, data) in candidates {
+                XCTAssertFalse(preparedKey.isValidSignature(candidate, for: data))
+                XCTAssertEqual(
+                    preparedKey.isValidSignature(candidate, for: data),
+                    privateKey.publicKey.isValidSignature(candidate, for: data)
+                )
+            }
+        }
+    }
+
+    func testKeyAgreementMatchesPublicKey() throws {
+        let peer = P256.KeyAgreement.PrivateKey()
+        let preparedPeer = try P256.KeyAgreement._PreparedPublicKey(peer.publicKey)
+
+        for _ in 0..<10 {
+            let privateKey = P256.KeyAgreement.PrivateKey()
+            let expected = try privateKey.sharedSecretFromKeyAgreement(with: peer.publicKey)
+            let sharedSecret = try privateKey._sharedSecretFromKeyAgreement(with: preparedPeer)
+            XCTAssertEqual(
+                sharedSecret.withUnsafeBytes { Data($0) },
+                expected.withUnsafeBytes { Data($0) }
+            )
+        }
+    }
+
+    func testCacheSharesPreparedKeys() throws {
+        let cache = P256._PreparedPublicKeyCache(maximumByteCount: 1 << 20)
+        let privateKey = P256.Signing.PrivateKey()
+        let keyAgreementKey = try P256.KeyAgreement.PublicKey(
+            x963Representation: privateKey.publicKey.x963Representation
+        )
+
+        let first = try cache.preparedKey(for: privateKey.publicKey)
+        let second = try cache.preparedKey(for: privateKey.publicKey)
+        let third = try cache.preparedKey(for: keyAgreementKey)
+        XCTAssertEqual(cache.count, 1)
+        XCTAssertEqual(cache.byteCount, first._byteCount)
+        XCTAssertEqual(second._byteCount, first._byteCount)
+        XCTAssertEqual(third.publicKey.x963Representation, keyAgreementKey.x963Representation)
+
+        let message = Array("hello".utf8)
+        XCTAssertTrue(second.isValidSignature(try privateKey.signature(for: message), for: message))
+
+        cache.removeAll()
+        XCTAssertEqual(cache.count, 0)
+        XCTAssertEqual(cache.byteCount, 0)
+    }
+
+    func testCacheStaysWithinBudget() throws {
+        let keys = (0..<4).map { _ in P256.Signing.PrivateKey().publicKey }
+        let keyByteCount = try P256.Signing._PreparedPublicKey(keys[0])._byteCount
+        let cache = P256._PreparedPublicKeyCache(maximumByteCount: 3 * keyByteCount)
+
+        _ = try cache.preparedKey(for: keys[0])
+        _ = try cache.preparedKey(for: keys[1])
+        _ = try cache.preparedKey(for: keys[2])
+        XCTAssertEqual(cache.count, 3)
+
+        for key in keys + keys.reversed() {
+            _ = try cache.preparedKey(for: key)
+            XCTAssertLessThanOrEqual(cache.count, 3)
+            XCTAssertLessThanOrEqual(cache.byteCount, cache.maximumByteCount)
+        }
+        XCTAssertEqual(cache.count, 3)
+    }
+
+    func testCacheTooSmallForAnyKey() throws {
+        let cache = P256._PreparedPublicKeyCache(maximumByteCount: 1000)
+        let privateKey = P256.Signing.PrivateKey()
+        let preparedKey = try cache.preparedKey(for: privateKey.publicKey)
+        XCTAssertEqual(cache.count, 0)
+        XCTAssertEqual(cache.byteCount, 0)
+
+        let message = Array("hello".utf8)
+        XCTAssertTrue(preparedKey.isValidSignature(try privateKey.signature(for: message), for: message))
+    }
+}
@@ -88,4 +88,54 @@ class PBKDF2Tests: XCTestCase {
         XCTAssertNoThrow(try KDF.Insecure.PBKDF2.deriveKey(from: contiguousInput, salt: contiguousSalt, using: .insecureSHA1,
                                                            outputByteCount: 20, rounds: 210_000))
     }
+
+    func testBatchMatchesSingleDerivation() throws {
+        // SHA-256 keys may be derived four output blocks at a time, so these cover partly filled groups of lanes and
+        // keys that span several blocks.
+        for hash in [KDF.Insecure.PBKDF2.HashFunction.sha256, .insecureSHA1, .sha512] {
+            for count in [0, 1, 3, 4, 5, 9] {
+                for outputByteCount in [16, 32, 100] {
+                    let batch = (0..<count).map { index in
+                        (
+                            password: (0..<(index * 29 % 100)).map { UInt8(truncatingIfNeeded: $0 &* 7 &+ index) },
+                            salt: (0..<(index * 5 % 20)).map { UInt8(truncatingIfNeeded: $0 &+ index) }
+                        )
+                    }
+                    let keys = try KDF.Insecure.PBKDF2._deriveKeys(from: batch, using: hash,
+                                                                  outputByteCount: outputByteCount,
+                                                                  unsafeUncheckedRounds: 100)
+                    let expectedKeys = try batch.map {
+                        try KDF.Insecure.PBKDF2.deriveKey(from: $0.password, salt: $0.salt, using: hash,
+                                                          outputByteCount: outputByteCount,
+                                                          unsafeUncheckedRounds: 100)
+                    }
+                    XCTAssertEqual(keys, expectedKeys)
+                }
+            }
+        }
+    }
+
+    func testBatchRFCVectors() throws {
+        var decoder = try orFail { try RFCVectorDecoder(bundleType: self, fileName: "rfc-6070-PBKDF2-SHA1") }
+        let vectors = try orFail { try decoder.decode([RFCTestVector].self) }.filter { $0.rounds <= 4096 }
+
+        for vector in vectors {
+            let (_, discontiguousInput) = vector.inputSecret.asDataProtocols()
+            let keys = try KDF.Insecure.PBKDF2._deriveKeys(from: [(password: discontiguousInput, salt: vector.salt)],
+                                                          using: .insecureSHA1,
+                                                          outputByteCount: vector.outputLength,
+                                                          unsafeUncheckedRounds: vector.rounds)
+            XCTAssertEqual(keys, [SymmetricKey(data: vector.derivedKey)])
+        }
+    }
+
+    func testBatchRoundsParameterCheck() {
+        let batch = [(password: Data("password".utf8), salt: Data("salt".utf8))]
+
+        XCTAssertThrowsError(try KDF.Insecure.PBKDF2._deriveKeys(from: batch, using: .sha256,
+                                                                outputByteCount: 32, rounds: 209_999))
+
+        XCTAssertNoThrow(try KDF.Insecure.PBKDF2._deriveKeys(from: batch, using: .sha256,
+                                                            outputByteCount: 32, unsafeUncheckedRounds: 209_999))
+    }
 }
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+import _CryptoExtras
+import XCTest
+
+final class SHA256BatchTests: XCTestCase {
+    func testBatchMatchesOneShot() {
+        let messages = [0, 1, 55, 56, 63, 64, 65, 1024, 4096].map { size in
+            (0..<size).map { UInt8(truncatingIfNeeded: $0 &* 7 &+ size) }
+        }
+
+        let digests = SHA256._hash(batch: messages)
+        XCTAssertEqual(digests.count, messages.count * 32)
+        for (index, message) in messages.enumerated() {
+            let expected = Data(SHA256.hash(data: message))
+            XCTAssertEqual(digests[(index * 32)..<((index + 1) * 32)], expected)
+        }
+
+        let (_, discontiguous) = messages[7].asDataProtocols()
+        XCTAssertEqual(SHA256._hash(batch: [discontiguous]), Data(SHA256.hash(data: messages[7])))
+    }
+
+    func testBatchOfEqualLengthMessages() {
+        // Runs of 4, 8 and 16 equal-length messages may be hashed together, and this many messages takes several
+        // calls.
+        let sizes =
+            Array(repeating: 55, count: 5) + Array(repeating: 64, count: 4) + [3] + Array(repeating: 200, count: 30)
+        let messages = sizes.enumerated().map { index, size in
+            (0..<size).map { UInt8(truncatingIfNeeded: $0 &* 3 &+ index) }
+        }
+
+        // A DispatchData of one region is contiguous, so the messages are hashed in place apart from the one that is
+        // split in two.
+        let contiguous = messages.map { message in message.withUnsafeBytes { DispatchData(bytes: $0) } }
+        var withDiscontiguous = contiguous
+        withDiscontiguous[6] = messages[6].asDataProtocols().discontiguous
+
+        for batch in [contiguous, withDiscontiguous] {
+            let digests = SHA256._hash(batch: batch)
+            XCTAssertEqual(digests.count, messages.count * 32)
+            for (index, message) in messages.enumerated() {
+                let expected = Data(SHA256.hash(data: message))
+                XCTAssertEqual(digests[(index * 32)..<((index + 1) * 32)], expected)
+            }
+        }
+    }
+
+    func testBatchIntoBuffer() throws {
+        let first = Array("first message".utf8)
+        let second = Array("second message".utf8)
+        var output = [UInt8](repeating: 0, count: 64)
+
+        try first.withUnsafeBytes { firstBytes in
+            try second.withUnsafeBytes { secondBytes in
+                try output.withUnsafeMutableBytes { outputBytes in
+                    try SHA256._hash(batch: [firstBytes, secondBytes], into: outputBytes)
+                }
+            }
+        }
+        XCTAssertEqual(Data(output.prefix(32)), Data(SHA256.hash(data: first)))
+        XCTAssertEqual(Data(output.suffix(32)), Data(SHA256.hash(data: second)))
+
+        XCTAssertEqual(SHA256._hash(batch: [[UInt8]]()), Data())
+    }
+
+    func testBatchRejectsShortOutput() {
+        var output = [UInt8](repeating: 0, count: 63)
+        XCTAssertThrowsError(
+            try output.withUnsafeMutableBytes { outputBytes in
+                let emptyMessages = Array(repeating: UnsafeRawBufferPointer(start: nil, count: 0), count: 2)
+                try SHA256._hash(batch: emptyMessages, into: outputBytes)
+            }
+        ) { error in
+            guard case CryptoKitError.incorrectParameterSize = error else { return XCTFail("Unexpected error: \(error)") }
+        }
+    }
+}
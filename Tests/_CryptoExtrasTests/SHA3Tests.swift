@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the SwiftCrypto open source project
+//
+// Copyright (c) 2025 Apple Inc. and the SwiftCrypto project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of SwiftCrypto project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Crypto
+import Foundation
+import _CryptoExtras
+import XCTest
+
+final class SHA3Tests: XCTestCase {
+    // These sizes straddle every SHA-3 and SHAKE rate (72, 104, 136 and 168 bytes) in both directions.
+    private static let pieceSizes = [1, 71, 0, 33, 104, 136, 167, 168, 169, 200]
+
+    private let message = (0..<2000).map { UInt8(truncatingIfNeeded: $0 &* 7) }
+
+    private func checkHashFunction<H: HashFunction>(
+        _: H.Type,
+        empty: String,
+        longMessage: String,
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) throws {
+        XCTAssertEqual(Data(H.hash(data: Data())), try Data(hexString: empty), file: file, line: line)
+        XCTAssertEqual(Data(H.hash(data: self.message)), try Data(hexString: longMessage), file: file, line: line)
+        XCTAssertEqual(H.Digest.byteCount, try Data(hexString: empty).count, file: file, line: line)
+
+        var hasher = H()
+        var offset = 0
+        for size in Self.pieceSizes {
+            let end = min(offset + size, self.message.count)
+            hasher.update(data: self.message[offset..<end])
+            offset = end
+        }
+
+        // Finalizing and copying a hasher both leave the original usable.
+        let prefixDigest = hasher.finalize()
+        var copy = hasher
+        copy.update(data: Data("diverged".utf8))
+        hasher.update(data: self.message[offset...])
+        XCTAssertEqual(Data(hasher.finalize()), try Data(hexString: longMessage), file: file, line: line)
+        XCTAssertEqual(prefixDigest, H.hash(data: self.message[..<offset]), file: file, line: line)
+        XCTAssertNotEqual(copy.finalize(), hasher.finalize(), file: file, line: line)
+
+        let (contiguous, discontiguous) = self.message.asDataProtocols()
+        XCTAssertEqual(H.hash(data: contiguous), H.hash(data: discontiguous), file: file, line: line)
+    }
+
+    func testSHA3_256() throws {
+        try self.checkHashFunction(
+            SHA3_256.self,
+            empty: "a7ffc6f8bf1ed76651c14756a061d662f580ff4de43b49fa82d80a4b80f8434a",
+            longMessage: "d2a361f5de6be07ef61a748494174e86c0abcd18c5f2cb34de1186294dddd2fe"
+        )
+    }
+
+    func testSHA3_384() throws {
+        try self.checkHashFunction(
+            SHA3_384.self,
+            empty: "0c63a75b845e4f7d01107d852e4c2485c51a50aaaa94fc61995e71bbee983a2ac3713831264adb47fb6bd1e058d5f004",
+            longMessage: "d6c23a6ed0f130559ef9f3c23d161fa5539fe54f16fcc23779910c1808cba9a71553e30e01bcf2c3f48939b7077cb9b8"
+        )
+    }
+
+    func testSHA3_512() throws {
+        try self.checkHashFunction(
+            SHA3_512.self,
+            empty: "a69f73cca23a9ac5c8b567dc185a756e97c982164fe25859e0d1dcc1475c80a6"
+                + "15b2123af1f5f94c11e3e9402c3ac558f500199d95b6d3e301758586281dcd26",
+            longMessage: "45014a0be82a03b23edd5acf2106021fa93f5f5553de8e8d1e72bbc1083a2f5e"
+                + "4e071094acf10d593b280644f5a64821826042509b03b33c29a64d5842238575"
+        )
+    }
+
+    func testSHAKEDigests() throws {
+        XCTAssertEqual(
+            Data(SHAKE128.hash(data: Data())),
+            try Data(hexString: "7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26")
+        )
+        XCTAssertEqual(
+            Data(SHAKE256.hash(data: Data())),
+            try Data(
+                hexString: "46b9dd2b0ba88d13233b3feb743eeb243fcd52ea62b81b82b50c27646ed5762f"
+                    + "d75dc4ddd8c0f200cb05019d67b592f6fc821c49479ab48640292eacb3b7c4be"
+            )
+        )
+    }
+
+    func testSHAKE128Squeezing() throws {
+        let output = SHAKE128.hash(data: self.message, outputByteCount: 500)
+        XCTAssertEqual(output.suffix(20), try Data(hexString: "835f4be755b289ef38129182c5e65c3eeaf68412"))
+        XCTAssertEqual(output.prefix(32), Data(SHAKE128.hash(data: self.message)))
+
+        var hasher = SHAKE128()
+        hasher.update(data: self.message)
+        var squeezer = hasher.makeSqueezer()
+        var squeezed = Data()
+        for size in Self.pieceSizes.prefix(6) {
+            squeezed += squeezer.squeeze(outputByteCount: size)
+        }
+        squeezed += squeezer.squeeze(outputByteCount: 500 - squeezed.count)
+        XCTAssertEqual(squeezed, output)
+    }
+
+    func testSHAKE256Squeezing() throws {
+        let output = SHAKE256.hash(data: self.message, outputByteCount: 500)
+        XCTAssertEqual(output.suffix(20), try Data(hexString: "e7c9507bdecb6b89d14e71ac48fcf1fc8b6694c5"))
+        XCTAssertEqual(output.prefix(64), Data(SHAKE256.hash(data: self.message)))
+
+        var hasher = SHAKE256()
+        hasher.update(data: self.message)
+        var squeezer = hasher.makeSqueezer()
+        var copy = squeezer
+        var squeezed = [UInt8](repeating: 0, count: 500)
+        squeezed.withUnsafeMutableBytes { squeezedBytes in
+            var offset = 0
+            for size in Self.pieceSizes.prefix(6) {
+                squeezer.squeeze(into: UnsafeMutableRawBufferPointer(rebasing: squeezedBytes[offset..<(offset + size)]))
+                offset += size
+            }
+            squeezer.squeeze(into: UnsafeMutableRawBufferPointer(rebasing: squeezedBytes[offset...]))
+        }
+        XCTAssertEqual(Data(squeezed), output)
+
+        // A copied squeezer continues independently from where it was copied.
+        XCTAssertEqual(copy.squeeze(outputByteCount: 500), output)
+        XCTAssertEqual(hasher.finalize(outputByteCount: 0), Data())
+    }
+}
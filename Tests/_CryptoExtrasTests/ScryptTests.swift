@@ -84,4 +84,47 @@ class ScryptTests: XCTestCase {
             try orFail { try self.testRFCVector(vector) }
         }
     }
+
+    func testConcurrentDerivationMatchesRFCVectors() throws {
+        var decoder = try orFail { try RFCVectorDecoder(bundleType: self, fileName: "rfc-7914-scrypt") }
+        let vectors = try orFail { try decoder.decode([RFCTestVector].self) }
+
+        for vector in vectors where vector.parallelism > 1 {
+            for maxThreadCount in [1, 2, 16] {
+                let derivedKey = try KDF.Scrypt._deriveKey(from: vector.inputSecret, salt: vector.salt,
+                                                           outputByteCount: vector.outputLength,
+                                                           rounds: vector.rounds,
+                                                           blockSize: vector.blockSize,
+                                                           parallelism: vector.parallelism,
+                                                           maxThreadCount: maxThreadCount)
+                XCTAssertEqual(derivedKey, SymmetricKey(data: vector.derivedKey))
+            }
+        }
+    }
+
+    func testConcurrentDerivationWithinMemoryLimit() throws {
+        let (password, salt) = (Array("password".utf8), Array("salt".utf8))
+        let expectedDK = try KDF.Scrypt.deriveKey(from: password, salt: salt, outputByteCount: 64,
+                                                  rounds: 1024, blockSize: 4, parallelism: 6)
+
+        // The blocks take 128 * 4 * 6 bytes, and each one being processed needs 128 * 4 * 1026 more. These allow
+        // room for zero, one, three and all six blocks to be processed at once.
+        let blockScratchByteCount = 128 * 4 * 1026
+        for maxMemory in [128 * 4 * 6, 128 * 4 * 6 + blockScratchByteCount, 128 * 4 * 6 + 3 * blockScratchByteCount, nil] {
+            let derive = {
+                try KDF.Scrypt._deriveKey(from: password, salt: salt, outputByteCount: 64,
+                                          rounds: 1024, blockSize: 4, parallelism: 6,
+                                          maxMemory: maxMemory, maxThreadCount: 6)
+            }
+            if maxMemory == 128 * 4 * 6 {
+                XCTAssertThrowsError(try derive())
+            } else {
+                XCTAssertEqual(try derive(), expectedDK)
+            }
+        }
+
+        XCTAssertThrowsError(try KDF.Scrypt._deriveKey(from: password, salt: salt, outputByteCount: 64,
+                                                       rounds: 1000, blockSize: 4, parallelism: 6,
+                                                       maxThreadCount: 6))
+    }
 }
@@ -56,4 +56,44 @@ final class TestRSABlindSigningAPI: XCTestCase {
             }
         }
     }
+
+    func testBatchBlindSignaturesMatchSingleBlindSignatures() throws {
+        let privateKey = try _RSA.BlindSigning.PrivateKey(keySize: .bits2048)
+        let publicKey = privateKey.publicKey
+
+        let preparedMessages = (0..<17).map { publicKey.prepare(Data("This is some input data \($0)".utf8)) }
+        let blindingResults = try preparedMessages.map { try publicKey.blind($0) }
+        let blindSignatures = try privateKey.blindSignatures(for: blindingResults.map(\.blindedMessage))
+        XCTAssertEqual(blindSignatures.count, preparedMessages.count)
+
+        for (index, blindSignature) in blindSignatures.enumerated() {
+            let expected = try privateKey.blindSignature(for: blindingResults[index].blindedMessage)
+            XCTAssertEqual(blindSignature.rawRepresentation, expected.rawRepresentation)
+
+            let unblindedSignature = try publicKey.finalize(
+                blindSignature,
+                for: preparedMessages[index],
+                blindingInverse: blindingResults[index].inverse
+            )
+            XCTAssert(publicKey.isValidSignature(unblindedSignature, for: preparedMessages[index]))
+        }
+
+        XCTAssert(try privateKey.blindSignatures(for: [Data]()).isEmpty)
+    }
+
+    func testBatchBlindSignaturesThrowOnInvalidMessage() throws {
+        let privateKey = try _RSA.BlindSigning.PrivateKey(keySize: .bits2048)
+        let publicKey = privateKey.publicKey
+        var blindedMessages = try (0..<4).map {
+            try publicKey.blind(publicKey.prepare(Data("This is some input data \($0)".utf8))).blindedMessage
+        }
+        blindedMessages[2] = Data(repeating: 0xff, count: 10)
+
+        XCTAssertThrowsError(try privateKey.blindSignatures(for: blindedMessages)) { error in
+            guard let error = error as? CryptoKitError, case .incorrectParameterSize = error else {
+                XCTFail("Unexpected error: \(error)")
+                return
+            }
+        }
+    }
 }
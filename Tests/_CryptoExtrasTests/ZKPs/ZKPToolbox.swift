@@ -174,4 +174,61 @@ class ZKPToolboxTests: XCTestCase {
         try EmptyWorkflow(CurveType: P384.self)
         try EmptyWorkflow(CurveType: P521.self)
     }
+
+    /// Checks the multi-scalar multiplication against separate multiplications and additions, on both sides of the
+    /// batch size where it switches to Pippenger's method.
+    func multiScalarMultiplication<Curve: SupportedCurveDetailsImpl>(CurveType _: Curve.Type) {
+        typealias Element = GroupImpl<Curve>.Element
+        for count in [1, 2, 3, 5, 200] {
+            var terms = (0..<count).map { _ in (scalar: Element.Scalar.random, element: Element.random) }
+            // Repeated elements take the doubling case of the addition formula.
+            if count > 1 {
+                terms[1].element = terms[0].element
+            }
+            let expected = terms.dropFirst().reduce(terms[0].scalar * terms[0].element) { sum, term in
+                sum + term.scalar * term.element
+            }
+            XCTAssert(Element.publicMultiScalarMultiplication(terms) == expected)
+        }
+    }
+
+    func testMultiScalarMultiplication() {
+        multiScalarMultiplication(CurveType: P256.self)
+        multiScalarMultiplication(CurveType: P384.self)
+        multiScalarMultiplication(CurveType: P521.self)
+    }
+
+    /// Checks that multiplying a prepared element matches multiplying the plain one.
+    func preparedElement<Curve: SupportedCurveDetailsImpl>(CurveType _: Curve.Type) {
+        typealias Element = GroupImpl<Curve>.Element
+        for element in [Element.generator, Element.random] {
+            let prepared = element.prepared()
+            XCTAssert(prepared == element)
+            let random = Element.Scalar.random
+            for scalar in [random, -random, random - random] {
+                XCTAssert(scalar * prepared == scalar * element)
+            }
+        }
+    }
+
+    func testPreparedElement() {
+        preparedElement(CurveType: P256.self)
+        preparedElement(CurveType: P384.self)
+        preparedElement(CurveType: P521.self)
+    }
+
+    /// Checks that serializing elements together matches serializing each one.
+    func batchSerialization<Curve: SupportedCurveDetailsImpl>(CurveType _: Curve.Type) {
+        typealias Element = GroupImpl<Curve>.Element
+        for count in [0, 1, 2, 20] {
+            let elements = (0..<count).map { _ in Element.random }
+            XCTAssertEqual(Element.oprfRepresentations(of: elements), elements.map { $0.oprfRepresentation })
+        }
+    }
+
+    func testBatchSerialization() {
+        batchSerialization(CurveType: P256.self)
+        batchSerialization(CurveType: P384.self)
+        batchSerialization(CurveType: P521.self)
+    }
 }
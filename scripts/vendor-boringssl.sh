@@ -296,6 +296,19 @@ echo "PROTECTING against executable stacks"
 echo "PATCHING BoringSSL"
 git apply "${HERE}/scripts/patch-1-inttypes.patch"
 git apply "${HERE}/scripts/patch-2-more-inttypes.patch"
+git apply "${HERE}/scripts/patch-3-keccak-x4.patch"
+git apply "${HERE}/scripts/patch-5-ec-mul-public-batch.patch"
+git apply "${HERE}/scripts/patch-6-ec-point-precomp.patch"
+git apply "${HERE}/scripts/patch-7-ec-point2oct-batch.patch"
+git apply "${HERE}/scripts/patch-8-ecdsa-verify-batch.patch"
+git apply "${HERE}/scripts/patch-9-ec-point-table.patch"
+git apply "${HERE}/scripts/patch-10-bn-ctx-thread-local.patch"
+git apply "${HERE}/scripts/patch-11-scrypt-simd-romix.patch"
+git apply "${HERE}/scripts/patch-12-pbkdf2-direct.patch"
+git apply "${HERE}/scripts/patch-13-rsaz-avx512-ifma.patch"
+git apply "${HERE}/scripts/patch-14-rsa-blinding-lock-free.patch"
+git apply "${HERE}/scripts/patch-15-sha256-batch.patch"
+git apply "${HERE}/scripts/patch-16-keccak-sha3-384.patch"
 
 # We need BoringSSL to be modularised
 echo "MODULARISING BoringSSL"